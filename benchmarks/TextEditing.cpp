@@ -0,0 +1,103 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// Compares inserting characters at random places in a large document stored in a single sf::String (as TextBox used to do)
+// with inserting them in the rope that TextBox now uses, and measures typing in a TextBox containing the same document
+
+#include <TGUI/TextRope.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <SFML/System/Clock.hpp>
+#include <iostream>
+#include <random>
+
+namespace
+{
+    template <typename Function>
+    double measureMilliseconds(unsigned int iterations, Function function)
+    {
+        sf::Clock clock;
+        for (unsigned int i = 0; i < iterations; ++i)
+            function();
+
+        return clock.getElapsedTime().asMicroseconds() / 1000.0;
+    }
+}
+
+int main()
+{
+    const std::size_t documentSize = 10 * 1024 * 1024;
+    const unsigned int iterations = 1000;
+
+    sf::String document;
+    while (document.getSize() < documentSize)
+        document += "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore.\n";
+
+    std::vector<std::size_t> positions;
+    std::mt19937 randomGenerator{42};
+    for (unsigned int i = 0; i < iterations; ++i)
+        positions.push_back(randomGenerator() % document.getSize());
+
+    sf::String string = document;
+    unsigned int stringIndex = 0;
+    const double stringTime = measureMilliseconds(iterations, [&]{
+        string.insert(positions[stringIndex++], "x");
+    });
+
+    tgui::priv::TextRope rope{document};
+    unsigned int ropeIndex = 0;
+    const double ropeTime = measureMilliseconds(iterations, [&]{
+        rope.insert(positions[ropeIndex++], "x");
+    });
+
+    if (rope.toString() != string)
+    {
+        std::cerr << "The rope and the string contain a different text" << std::endl;
+        return 1;
+    }
+
+    // The text box has to word-wrap the whole document once when the text is set, but typing should only wrap one paragraph
+    auto textBox = tgui::TextBox::create();
+    textBox->setSize({800, 600});
+
+    sf::Clock clock;
+    textBox->setText(document);
+    const double setTextTime = clock.getElapsedTime().asMicroseconds() / 1000.0;
+
+    unsigned int textBoxIndex = 0;
+    const double typingTime = measureMilliseconds(iterations, [&]{
+        textBox->setSelectedText(positions[textBoxIndex], positions[textBoxIndex]);
+        textBox->textEntered('x');
+        ++textBoxIndex;
+    });
+
+    std::cout << "Inserting " << iterations << " characters in a document of " << document.getSize() << " characters:" << std::endl;
+    std::cout << "  sf::String:        " << stringTime << " ms" << std::endl;
+    std::cout << "  rope:              " << ropeTime << " ms" << std::endl;
+    std::cout << "  speedup:           " << (stringTime / ropeTime) << "x" << std::endl;
+    std::cout << "  TextBox::setText:  " << setTextTime << " ms (once)" << std::endl;
+    std::cout << "  TextBox typing:    " << typingTime << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Compares measuring text with the cached glyph metrics (as done by tgui::Text) to looking up every glyph in the font
+
+#include <TGUI/Text.hpp>
+#include <SFML/System/Clock.hpp>
+#include <iostream>
+
+namespace
+{
+    // The way Text::getLineWidth measured text before the glyph metrics were cached
+    float getLineWidthUncached(const sf::String& text, const tgui::Font& font, unsigned int characterSize)
+    {
+        float width = 0.0f;
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < text.getSize(); ++i)
+        {
+            float charWidth;
+            const std::uint32_t curChar = text[i];
+            if (curChar == '\n')
+                break;
+            else if (curChar == '\t')
+                charWidth = font.getGlyph(' ', characterSize, false).advance * 4.0f;
+            else
+                charWidth = font.getGlyph(curChar, characterSize, false).advance;
+
+            const float kerning = font.getKerning(prevChar, curChar, characterSize);
+
+            width = width + charWidth + kerning;
+            prevChar = curChar;
+        }
+
+        return width;
+    }
+
+    template <typename Function>
+    double measureMilliseconds(unsigned int iterations, Function function)
+    {
+        sf::Clock clock;
+        for (unsigned int i = 0; i < iterations; ++i)
+            function();
+
+        return clock.getElapsedTime().asMicroseconds() / 1000.0;
+    }
+}
+
+int main()
+{
+    const tgui::Font font = tgui::getGlobalFont();
+    const unsigned int iterations = 200;
+
+    sf::String text;
+    while (text.getSize() < 10000)
+        text += "Lorem ipsum dolor sit amet,\tconsectetur adipiscing elit. AVA To Wo ";
+
+    // Measuring alternating text sizes is what happens when widgets with different text sizes are drawn
+    volatile float result = 0;
+    const double uncachedTime = measureMilliseconds(iterations, [&]{
+        result = result + getLineWidthUncached(text, font, 13) + getLineWidthUncached(text, font, 18);
+    });
+    const double cachedTime = measureMilliseconds(iterations, [&]{
+        result = result + tgui::Text::getLineWidth(text, font, 13) + tgui::Text::getLineWidth(text, font, 18);
+    });
+
+    if (getLineWidthUncached(text, font, 13) != tgui::Text::getLineWidth(text, font, 13))
+    {
+        std::cerr << "Cached and uncached measurements differ" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Measuring " << text.getSize() << " characters " << 2 * iterations << " times:" << std::endl;
+    std::cout << "  uncached: " << uncachedTime << " ms" << std::endl;
+    std::cout << "  cached:   " << cachedTime << " ms" << std::endl;
+    std::cout << "  speedup:  " << (uncachedTime / cachedTime) << "x" << std::endl;
+    return 0;
+}
@@ -0,0 +1,606 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+// Measures how long it takes to parse a large widget file and how many memory allocations are made while doing so,
+// for the stream based parser that TGUI used before, the text format parsed directly from memory and the binary format
+
+#include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/to_string.hpp>
+#include <SFML/System/Clock.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
+    for (;;) \
+    { \
+        stream >> std::ws; \
+        if (stream.peek() == EOF) \
+            break; \
+        \
+        if (stream.peek() == '/') \
+        { \
+            char c; \
+            stream.read(&c, 1); \
+            if (stream.peek() == '/') \
+            { \
+                while (stream.peek() != EOF) \
+                { \
+                    stream.read(&c, 1); \
+                    if (c == '\n') \
+                        break; \
+                } \
+            } \
+            else if (stream.peek() == '*') \
+            { \
+                while (stream.peek() != EOF) \
+                { \
+                    stream.read(&c, 1); \
+                    if (stream.peek() == '*') \
+                    { \
+                        stream.read(&c, 1); \
+                        if (stream.peek() == '/') \
+                        { \
+                            stream.read(&c, 1); \
+                            break; \
+                        } \
+                    } \
+                } \
+                continue; \
+            } \
+            else \
+                return "Unexpected '/' found."; \
+            \
+            continue; \
+        } \
+        break; \
+    } \
+    \
+    if (stream.peek() == EOF) \
+    { \
+        if (ReturnErrorOnEOF) \
+            return "Unexpected EOF while parsing."; \
+        else \
+            return ""; \
+    }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Copy of the parser that read the widget file character by character from a std::stringstream,
+    // which serves as the baseline that the current parser is compared with
+    namespace reference
+    {
+        using namespace tgui;
+
+        // Forward declare one of the functions to solve circular dependency
+        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string readWord(std::stringstream& stream)
+        {
+            std::string word = "";
+            while (stream.peek() != EOF)
+            {
+                char c = static_cast<char>(stream.peek());
+                if (c == '\r')
+                {
+                    stream.read(&c, 1);
+                    return word;
+                }
+                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                {
+                    stream.read(&c, 1);
+
+                    if ((c == '/') && (stream.peek() == '/'))
+                    {
+                        while (stream.peek() != EOF)
+                        {
+                            stream.read(&c, 1);
+                            if (c == '\n')
+                            {
+                                assert(!word.empty()); // No known case in which you can pass here with an empty word
+                                return word;
+                            }
+                        }
+                    }
+                    else if ((c == '/') && (stream.peek() == '*'))
+                    {
+                        while (stream.peek() != EOF)
+                        {
+                            stream.read(&c, 1);
+                            if (c == '*')
+                            {
+                                if (stream.peek() == '/')
+                                {
+                                    stream.read(&c, 1);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    else if (c == '"')
+                    {
+                        word.push_back(c);
+                        bool backslash = false;
+                        while (stream.peek() != EOF)
+                        {
+                            stream.read(&c, 1);
+                            word.push_back(c);
+
+                            if (c == '"' && !backslash)
+                                break;
+
+                            if (c == '\\' && !backslash)
+                                backslash = true;
+                            else
+                                backslash = false;
+                        }
+                    }
+                    else
+                        word.push_back(c);
+                }
+                else
+                    return word;
+            }
+
+            return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string readLine(std::stringstream& stream)
+        {
+            std::string line;
+            bool whitespaceFound = false;
+            while (stream.peek() != EOF)
+            {
+                char c = static_cast<char>(stream.peek());
+
+                if (c == '/')
+                {
+                    stream.read(&c, 1);
+                    if (stream.peek() == '/')
+                    {
+                        while (stream.peek() != EOF)
+                        {
+                            stream.read(&c, 1);
+                            if (c == '\n')
+                                break;
+                        }
+                    }
+                    else if (stream.peek() == '*')
+                    {
+                        while (stream.peek() != EOF)
+                        {
+                            stream.read(&c, 1);
+                            if (stream.peek() == '*')
+                            {
+                                stream.read(&c, 1);
+                                if (stream.peek() == '/')
+                                {
+                                    stream.read(&c, 1);
+                                    break;
+                                }
+                            }
+                        }
+                        continue;
+                    }
+                    else // The slash is part of the value
+                    {
+                        whitespaceFound = false;
+                        line.push_back(c);
+                    }
+
+                    continue;
+                }
+
+                if (c == '"')
+                {
+                    stream.read(&c, 1);
+                    line.push_back(c);
+
+                    bool backslash = false;
+                    while (stream.peek() != EOF)
+                    {
+                        stream.read(&c, 1);
+                        line.push_back(c);
+
+                        if (c == '"' && !backslash)
+                            break;
+
+                        if (c == '\\' && !backslash)
+                            backslash = true;
+                        else
+                            backslash = false;
+                    }
+
+                    if (stream.peek() == EOF)
+                        return "";
+
+                    c = static_cast<char>(stream.peek());
+                }
+
+                if ((c == '=') || (c == '{'))
+                    return "";
+                else if ((c == ';') || (c == '}'))
+                {
+                    // Remove trailing whitespace before returning the line
+                    line.erase(line.find_last_not_of(" \n\r\t")+1);
+                    return line;
+                }
+                else if (::isspace(c))
+                {
+                    stream.read(&c, 1);
+                    if (!whitespaceFound)
+                    {
+                        whitespaceFound = true;
+                        line.push_back(' ');
+                    }
+                }
+                else
+                {
+                    whitespaceFound = false;
+                    line.push_back(c);
+                    stream.read(&c, 1);
+                }
+            }
+
+            return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        {
+            // Read the assignment symbol from the stream and remove the whitespace behind it
+            char chr;
+            stream.read(&chr, 1);
+
+            REMOVE_WHITESPACE_AND_COMMENTS(true)
+
+            // Check for subsection as value
+            if (stream.peek() == '{')
+                return parseSection(stream, node, key);
+
+            // Read the value
+            std::string line = trim(readLine(stream));
+            if (!line.empty())
+            {
+                // Remove the ';' if it is there
+                if (stream.peek() == ';')
+                    stream.read(&chr, 1);
+
+                // Create a value node to store the value
+                auto valueNode = std::make_unique<DataIO::ValueNode>();
+                valueNode->value = line;
+
+                // It might be a list node
+                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                {
+                    valueNode->listNode = true;
+                    if (line.size() >= 3)
+                    {
+                        valueNode->valueList.push_back("");
+
+                        std::size_t i = 1;
+                        while (i < line.size()-1)
+                        {
+                            if (line[i] == ',')
+                            {
+                                i++;
+                                valueNode->valueList.back() = trim(valueNode->valueList.back());
+                                valueNode->valueList.push_back("");
+                            }
+                            else if (line[i] == '"')
+                            {
+                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
+                                i++;
+
+                                bool backslash = false;
+                                while (i < line.size()-1)
+                                {
+                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
+
+                                    if (line[i] == '"' && !backslash)
+                                    {
+                                        i++;
+                                        break;
+                                    }
+
+                                    if (line[i] == '\\' && !backslash)
+                                        backslash = true;
+                                    else
+                                        backslash = false;
+
+                                    i++;
+                                }
+                            }
+                            else
+                            {
+                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
+                                i++;
+                            }
+                        }
+
+                        valueNode->valueList.back() = trim(valueNode->valueList.back());
+                    }
+                }
+
+                node->propertyValuePairs[toLower(key)] = std::move(valueNode);
+                return "";
+            }
+            else
+            {
+                if (stream.peek() == EOF)
+                    return "Found EOF while trying to read a value.";
+                else
+                {
+                    chr = static_cast<char>(stream.peek());
+                    if (chr == '=')
+                        return "Found '=' while trying to read a value.";
+                    else if (chr == '{')
+                        return "Found '{' while trying to read a value.";
+                    else
+                        return "Found empty value.";
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        {
+            // Create a new node for this section
+            auto sectionNode = std::make_unique<DataIO::Node>();
+            sectionNode->parent = node.get();
+            sectionNode->name = sectionName;
+
+            // Read the brace from the stream
+            char chr;
+            stream.read(&chr, 1);
+
+            while (stream.peek() != EOF)
+            {
+                REMOVE_WHITESPACE_AND_COMMENTS(true)
+
+                std::string word = readWord(stream);
+                if (word == "")
+                {
+                    if (stream.peek() == EOF)
+                        return "Found EOF while trying to read property or nested section name.";
+                    else if (stream.peek() == '}')
+                    {
+                        node->children.push_back(std::move(sectionNode));
+
+                        stream.read(&chr, 1);
+
+                        // Ignore semicolon behind closing brace
+                        REMOVE_WHITESPACE_AND_COMMENTS(false)
+                        if (stream.peek() == ';')
+                            stream.read(&chr, 1);
+
+                        REMOVE_WHITESPACE_AND_COMMENTS(false)
+                        return "";
+                    }
+                    else if (stream.peek() != '{')
+                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                }
+
+                REMOVE_WHITESPACE_AND_COMMENTS(true)
+                if (stream.peek() == '{')
+                {
+                    std::string error = parseSection(stream, sectionNode, word);
+                    if (!error.empty())
+                        return error;
+                }
+                else if (stream.peek() == '=')
+                {
+                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    if (!error.empty())
+                        return error;
+                }
+                else
+                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+            }
+
+            return "Found EOF while reading section.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        {
+            REMOVE_WHITESPACE_AND_COMMENTS(false)
+
+            std::string word = readWord(stream);
+            if (word == "")
+            {
+                REMOVE_WHITESPACE_AND_COMMENTS(true)
+                if (stream.peek() != '{')
+                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+            }
+
+            REMOVE_WHITESPACE_AND_COMMENTS(true)
+            if (stream.peek() == '{')
+                return parseSection(stream, root, word);
+            else if (stream.peek() == '=')
+                return parseKeyValue(stream, root, word);
+            else
+                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::unique_ptr<DataIO::Node> parse(std::stringstream& stream)
+        {
+            auto root = std::make_unique<DataIO::Node>();
+
+            std::string error;
+            while (stream.peek() != EOF)
+            {
+                error = parseRootSection(stream, root);
+                if (!error.empty())
+                {
+                    if (stream.tellg() != std::stringstream::pos_type(-1))
+                    {
+                        std::string str = stream.str();
+                        auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
+                        std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
+                        throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
+                    }
+                    else
+                        throw Exception{"Error while parsing input. " + error};
+                }
+            }
+
+            return root;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::atomic<std::size_t> allocationCount{0};
+
+    struct Measurement
+    {
+        double milliseconds;
+        std::size_t allocations;
+    };
+
+    template <typename Function>
+    Measurement measure(unsigned int iterations, Function function)
+    {
+        const std::size_t allocationsBefore = allocationCount;
+
+        sf::Clock clock;
+        for (unsigned int i = 0; i < iterations; ++i)
+            function();
+
+        const double milliseconds = clock.getElapsedTime().asMicroseconds() / 1000.0;
+        return {milliseconds / iterations, (allocationCount - allocationsBefore) / iterations};
+    }
+
+    void printMeasurement(const std::string& name, const Measurement& measurement)
+    {
+        std::cout << "  " << name << measurement.milliseconds << " ms, " << measurement.allocations << " allocations" << std::endl;
+    }
+}
+
+// Count every allocation that is made by the program
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int main()
+{
+    const unsigned int widgetCount = 3000;
+    const unsigned int iterations = 20;
+
+    std::string text;
+    for (unsigned int i = 0; i < widgetCount; ++i)
+    {
+        text += "Button.\"Button" + std::to_string(i) + "\" {\n"
+                "    // Buttons are placed in a grid\n"
+                "    Position = (" + std::to_string((i % 50) * 110) + ", " + std::to_string((i / 50) * 40) + ");\n"
+                "    Size = (100, 30);\n"
+                "    Text = \"Click me\";\n"
+                "    TextSize = 13;\n"
+                "\n"
+                "    Renderer {\n"
+                "        BackgroundColor = #F5F5F5;\n"
+                "        BorderColor = #3C3C3C;\n"
+                "        Borders = (1, 1, 1, 1);\n"
+                "        TextColor = #3C3C3C;\n"
+                "        Texture = None;\n"
+                "    }\n"
+                "}\n"
+                "\n";
+    }
+
+    // Both parsers have to produce the same tree, otherwise comparing them is meaningless
+    std::stringstream referenceStream{text};
+    std::stringstream referenceOutput;
+    std::stringstream output;
+    tgui::DataIO::emit(reference::parse(referenceStream), referenceOutput);
+    tgui::DataIO::emit(tgui::DataIO::parse(text.data(), text.size()), output);
+    if (referenceOutput.str() != output.str())
+    {
+        std::cerr << "The parsers produced different results" << std::endl;
+        return 1;
+    }
+
+    std::stringstream binaryStream;
+    tgui::DataIO::emitBinary(tgui::DataIO::parse(text.data(), text.size()), binaryStream);
+    const std::string binary = binaryStream.str();
+
+    // The old parser could only read from a stream, so copying the text into the stream is part of its cost
+    const Measurement referenceMeasurement = measure(iterations, [&]{
+        std::stringstream stream{text};
+        reference::parse(stream);
+    });
+
+    const Measurement bufferMeasurement = measure(iterations, [&]{
+        tgui::DataIO::parse(text.data(), text.size());
+    });
+
+    const Measurement binaryMeasurement = measure(iterations, [&]{
+        tgui::DataIO::parseBinary(binary.data(), binary.size());
+    });
+
+    std::cout << "Parsing a widget file with " << widgetCount << " widgets (" << text.size() << " bytes as text, "
+              << binary.size() << " bytes as binary):" << std::endl;
+    printMeasurement("old stream parser: ", referenceMeasurement);
+    printMeasurement("text from memory:  ", bufferMeasurement);
+    printMeasurement("binary:            ", binaryMeasurement);
+    return 0;
+}
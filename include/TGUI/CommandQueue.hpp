@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_COMMAND_QUEUE_HPP
+#define TGUI_COMMAND_QUEUE_HPP
+
+#include <TGUI/Global.hpp>
+#include <functional>
+#include <atomic>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of functions that can be posted from any thread and that are executed on the thread that owns the gui
+    ///
+    /// Posting a command never blocks: multiple threads can post at the same time without taking a lock.
+    /// Only a single thread (the one that calls Gui::updateTime) is allowed to execute the commands.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters that can be used to find out whether commands are posted faster than they are executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::uint64_t postedCommands = 0;   ///< Amount of commands that were posted in total
+            std::uint64_t executedCommands = 0; ///< Amount of commands that were executed in total
+            std::uint64_t pendingCommands = 0;  ///< Amount of commands that are waiting to be executed
+            std::uint64_t peakPendingCommands = 0; ///< Highest amount of commands that were waiting at the same time
+            std::uint64_t throttledExecutions = 0; ///< Amount of times that commands were left in the queue due to the limit
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        ///
+        /// Commands that were never executed are destroyed without being called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        // The queue cannot be copied
+        CommandQueue(const CommandQueue& copy) = delete;
+        CommandQueue& operator=(const CommandQueue& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to the back of the queue
+        ///
+        /// @param command  Function to call on the thread that executes the commands
+        ///
+        /// This function is thread-safe.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands in the order in which they were posted
+        ///
+        /// @param maxCommands  Maximum amount of commands to execute, or 0 to execute all commands that are in the queue
+        ///
+        /// @return Amount of commands that were executed
+        ///
+        /// Commands that are posted while executing (e.g. by one of the commands) are only executed during the next call.
+        /// This function may only be called from one thread at a time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t execute(std::size_t maxCommands = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of commands that are waiting to be executed
+        ///
+        /// @return Number of pending commands
+        ///
+        /// This function is thread-safe, producers can use it to slow down when the gui can't keep up.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPendingCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns counters about the commands that were posted and executed
+        ///
+        /// @return Statistics of the queue
+        ///
+        /// This function is thread-safe, but the counters may already have changed when it returns.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Statistics getStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> command;
+        };
+
+        // Producers replace the head, the consumer follows the links starting from the tail.
+        // The tail is always a node of which the command was already executed (or the initial empty node).
+        std::atomic<Node*> m_head;
+        Node* m_tail;
+
+        std::atomic<std::uint64_t> m_postedCount{0};
+        std::atomic<std::uint64_t> m_executedCount{0};
+        std::atomic<std::uint64_t> m_peakPendingCount{0};
+        std::atomic<std::uint64_t> m_throttledCount{0};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMMAND_QUEUE_HPP
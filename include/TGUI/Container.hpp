@@ -28,13 +28,25 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/SpatialIndex.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Maps widget names to the widgets that have that name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        using WidgetNameIndex = std::unordered_map<sf::String, std::vector<Widget*>, StringHash>;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Container widget
     ///
@@ -169,6 +181,36 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following the names of the containers in which it is located
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "Panel.ChildWindow.Button"
+        ///
+        /// The first name in the path has to be the name of a direct child of this container, the second name has to be the
+        /// name of a direct child of that widget and so on. Unlike the get function, no recursive search is performed.
+        ///
+        /// @return Pointer to the widget that was found, or nullptr when any of the names in the path didn't exist
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following the names of the containers in which it is located
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "Panel.ChildWindow.Button"
+        ///
+        /// @return Pointer to the widget that was found, or nullptr when any of the names in the path didn't exist.
+        ///         The pointer will already be casted to the desired type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return std::dynamic_pointer_cast<T>(getByPath(path));
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -238,7 +280,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a text file
+        /// @brief Loads the child widgets from a text file or from a binary file created with saveWidgetsToBinaryFile
         /// @param filename  Filename of the widget file
         /// @throw Exception when file could not be opened or parsing failed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +295,20 @@ namespace tgui
         void saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /// @throw Exception when file could not be opened for writing
+        ///
+        /// The binary file can be loaded with loadWidgetsFromFile. It contains the same information as the text file, but it
+        /// can be loaded faster because it doesn't need to be tokenized and repeated names and values are only stored once.
+        /// Binary files are meant to be generated from text files (e.g. during the build), they can't be edited by hand.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryFile(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
@@ -270,11 +326,14 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves the child widgets to a text file
+        /// @brief Saves the child widgets to a stream
+        ///
+        /// @param stream  Stream to which the widget file will be added, e.g. a file or a stream on top of your own buffer
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// Each widget is written to the stream as soon as it has been saved, the description of all widgets is never kept
+        /// in memory at the same time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void saveWidgetsToStream(std::ostream& stream) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,6 +354,17 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the index of a widget in the list of child widgets, which determines the order in which they are drawn
+        ///
+        /// @param widget  The widget that should be moved
+        /// @param index   New index of the widget, 0 places it behind all other widgets
+        ///
+        /// @return False when the widget wasn't found or the index was too high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setWidgetIndex(const Widget::Ptr& widget, std::size_t index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -309,6 +379,62 @@ namespace tgui
         bool focusPreviousWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @param enabled  Should the contents of the container be cached?
+        ///
+        /// When the cache is enabled, the child widgets are only redrawn after they changed (e.g. when they were moved,
+        /// resized, hovered, focused, animated, received an event, when their renderer was changed or when their contents
+        /// were changed such as the text of a label). This greatly reduces the time needed to draw containers whose contents
+        /// rarely change. The cache is disabled by default.
+        ///
+        /// The texture has the size of the area that the container occupies in pixels, so the cached image stays sharp when
+        /// the view is zoomed or the window is scaled.
+        ///
+        /// @warning The cache is only used by Panel, ScrollablePanel, ChildWindow and Group.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to a texture that is reused until one of them changes
+        ///
+        /// @return Are the contents of the container cached?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forces the child widgets to be redrawn the next time the container is drawn
+        ///
+        /// This only has to be called when the render cache is enabled and a child widget was changed in a way that the
+        /// container can't detect, e.g. when a custom widget changes what it draws without calling any of the setters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRenderCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @param enabled   Should the spatial index be used?
+        /// @param cellSize  Width and height of the cells in which the container is divided
+        ///
+        /// Without the spatial index, every child widget has to be checked to find out which widget is below the mouse.
+        /// With the index, only the widgets that overlap with the cell below the mouse are checked, which is a lot faster
+        /// for containers with many widgets. The spatial index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled, float cellSize = 64);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Is the spatial index being used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focus or unfocus the widget
         /// @param focused  Is the widget focused?
@@ -327,6 +453,13 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position, size or any other property that affects the area of a child widget has changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -425,10 +558,19 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
+        // Widgets outside the area that was last passed to drawChildWidgets are skipped.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets that are located inside the given area, which is relative to the position of the widgets.
+        // The widgets are drawn with drawWidgetContainer, either directly or, when the render cache is enabled, to a texture
+        // that is only updated when something changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the index of the focused widget is. Returns 0 when no widget is focused and index+1 otherwise.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,15 +583,61 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the direct child with the given name, or the first one in the list when multiple children have that name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getDirectChild(const sf::String& widgetName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or destroys the index that contains all widgets inside this container, including the nested ones
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlobalWidgetIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of all widgets that is stored in the top-level container, or nullptr when it doesn't have one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        priv::WidgetNameIndex* findGlobalWidgetIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the child widgets with the ones described in the tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the tree of nodes that describes the child widgets and the renderers that they share
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Saves the renderers that are shared between several child widgets and returns their nodes. The renderers map is
+        // filled with either the node of the renderer that a widget doesn't share or the id of the shared renderer it uses.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::unique_ptr<DataIO::Node>> saveSharedRenderers(SavingRenderersMap& renderersMap) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_widgetNames;
 
+        // Names of the direct children, to find them without looping over all widgets
+        priv::WidgetNameIndex m_widgetNameIndex;
+
+        // Names of all widgets inside the container, including nested ones. Only created for the top-level container in Gui.
+        std::unique_ptr<priv::WidgetNameIndex> m_globalWidgetIndex;
+
         Widget::Ptr m_widgetBelowMouse;
         Widget::Ptr m_focusedWidget;
 
+        // The widget on which the mouse went down last, which may still need mouse move events while being dragged
+        Widget::Ptr m_widgetWithMouseDown;
+
         Vector2f m_prevInnerSize;
 
         // Did we enter handleEvent directly or because we got a MouseReleased event?
@@ -458,6 +646,20 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Cached image of the child widgets, which is only used when m_renderCacheEnabled is true
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheDirty = true;
+        mutable Vector2f m_renderCacheTopLeft;
+        mutable Vector2f m_renderCacheSize;
+        mutable std::unique_ptr<sf::RenderTexture> m_renderCache;
+
+        // Grid to quickly find the widgets below the mouse, which is a nullptr when the spatial index isn't used
+        std::unique_ptr<priv::SpatialIndex> m_spatialIndex;
+
+        // Area in which the child widgets were visible the last time the container was drawn
+        mutable FloatRect m_visibleArea;
+        mutable bool m_visibleAreaKnown = false;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
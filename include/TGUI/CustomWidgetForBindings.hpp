@@ -45,6 +45,12 @@ namespace tgui
         typedef std::shared_ptr<const CustomWidgetForBindings> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CustomWidgetForBindings();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new widget
         /// @return The new widget
@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DRAW_BATCH_HPP
+#define TGUI_DRAW_BATCH_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the geometry of the widgets and sends it to the render target in as few draw calls as possible
+    ///
+    /// While a batch is active for a render target, triangles that are drawn with the same texture are merged and only drawn
+    /// once the texture changes, the view changes (e.g. by Clipping) or something is drawn that can't be merged.
+    /// Because the geometry is still drawn in the same order, the result is identical to drawing everything separately.
+    ///
+    /// Custom widgets should draw via the static draw functions of this class instead of calling draw on the target directly,
+    /// otherwise their drawing may happen before the geometry of widgets below them when batching is enabled.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DrawBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DrawBatch() = default;
+
+
+        // The batch object cannot be copied
+        DrawBatch(const DrawBatch& copy) = delete;
+        DrawBatch& operator=(const DrawBatch& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether geometry is merged into as few draw calls as possible
+        ///
+        /// @param enabled  Should draw calls be batched?
+        ///
+        /// When batching is disabled, everything is drawn immediately but the draw calls are still counted.
+        /// Batching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether geometry is merged into as few draw calls as possible
+        ///
+        /// @return Are draw calls being batched?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the target between the last calls to begin and end
+        ///
+        /// @return Number of draw calls
+        ///
+        /// Drawables that are passed to the batch (e.g. shapes) are counted as a single draw call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Makes this the active batch for the given target until end is called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Draws the remaining geometry and makes the batch that was active before begin was called active again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices on the target, via the active batch if there is one for this target
+        ///
+        /// @param target       Target to which we are drawing
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        /// @param fontTexture  True when states.texture is a font texture, which has a white square in its top left corner
+        ///                     that allows merging untextured geometry into the same draw call
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                         const sf::RenderStates& states, bool fontTexture = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object on the target after drawing the pending geometry of the active batch
+        ///
+        /// @param target    Target to which we are drawing
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the pending geometry of the batch that is active for the target
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// This has to be called before changing the view of the target or drawing on it directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether geometry that is drawn on the target is currently being batched
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// @return Is there an active batch for the target that has batching enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBatching(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the active batch if it belongs to the given target, or a nullptr otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DrawBatch* getActiveBatch(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the vertices to the pending triangles, flushing the old ones first when they can't be merged
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, bool fontTexture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the pending triangles on the target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget* m_target = nullptr;
+        DrawBatch* m_previousBatch = nullptr;
+        bool m_batchingEnabled = false;
+        unsigned int m_drawCallCount = 0;
+
+        // Pending triangles, already transformed, that will all be drawn with the same texture
+        std::vector<sf::Vertex> m_vertices;
+        const sf::Texture* m_texture = nullptr;
+        bool m_fontTexture = false;
+
+        static DrawBatch* m_activeBatch;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DRAW_BATCH_HPP
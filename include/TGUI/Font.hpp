@@ -28,10 +28,13 @@
 
 #include <TGUI/Config.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <cstdint>
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -229,11 +232,90 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font loaded from the given file, sharing it with all other users of the same file
+        ///
+        /// @param filename  Filename of the font, relative to the resource path unless it is an absolute path
+        ///
+        /// @return Shared font, or nullptr when the filename is empty
+        ///
+        /// Fonts are only kept in the cache while something still uses them, so a font that is no longer in use will be
+        /// loaded from disk again when it is requested a second time.
+        ///
+        /// This function is used internally when deserializing fonts, e.g. when creating a Font from a filename.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> loadFromCache(const sf::String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of fonts in the cache that are still being used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCachedFontCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the combined file size of the fonts in the cache that are still being used
+        ///
+        /// @return Amount of bytes of font data that is kept in memory by the cached fonts, excluding the glyph textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFontCacheMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a font could be reused from the cache instead of being loaded again
+        ///
+        /// @return Amount of cache hits since the program started or since clearFontCache was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFontCacheHitCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a font had to be loaded from disk because it wasn't found in the cache
+        ///
+        /// @return Amount of cache misses since the program started or since clearFontCache was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFontCacheMissCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the total time that was spent loading fonts from disk
+        ///
+        /// @return Load time of all cache misses since the program started or since clearFontCache was called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static sf::Time getFontCacheLoadTime();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets all fonts in the cache and resets the counters
+        ///
+        /// Fonts that are still being used remain valid, they just won't be shared with fonts that are loaded afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearFontCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Removes the cache entries of fonts that are no longer used anywhere
+        static void removeExpiredFontsFromCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct FontCacheEntry
+        {
+            std::weak_ptr<sf::Font> font;
+            std::size_t fileSize;
+        };
+
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+
+        static std::map<sf::String, FontCacheEntry> m_fontCache; // Keys are filenames including the resource path
+        static std::size_t m_fontCacheHitCount;
+        static std::size_t m_fontCacheMissCount;
+        static sf::Time m_fontCacheLoadTime;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include <TGUI/Config.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Font.hpp>
+#include <SFML/System/String.hpp>
 #include <cstdint>
 #include <string>
 #include <memory>
@@ -166,6 +167,18 @@ namespace tgui
     TGUI_API std::string trim(std::string str);
 
 
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Hash function for sf::String, which allows it to be used as key in an unordered_map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TGUI_API StringHash
+        {
+            std::size_t operator()(const sf::String& str) const;
+        };
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_GLYPH_METRICS_CACHE_HPP
+#define TGUI_GLYPH_METRICS_CACHE_HPP
+
+#include <TGUI/Font.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <array>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Remembers the advance and kerning of the characters of a font with a specific size and boldness, so that measuring
+        // text doesn't have to go through sf::Font (which changes the size of the FreeType face and searches its glyph map)
+        // for every character. Latin-1 characters are stored in flat arrays, other characters are stored in a hash map.
+        // A tab is measured as 4 spaces.
+        // The caches are not thread-safe. Just like sf::Font, which they call when a value isn't cached yet, they may only be
+        // used from the thread that handles the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API GlyphMetricsCache
+        {
+        public:
+
+            GlyphMetricsCache(sf::Font& font, unsigned int characterSize, bool bold);
+
+            // Returns the cache for the given font, which is shared between all texts that use the same parameters.
+            // The font must not be a nullptr. The cache is destroyed automatically some time after the font is destroyed.
+            // Must only be called from the gui thread, the map of caches is not guarded by a mutex.
+            static GlyphMetricsCache& get(const Font& font, unsigned int characterSize, bool bold);
+
+            // Destroys all caches. Only needed when an sf::Font was reloaded while it was already in use.
+            static void clear();
+
+            float getAdvance(std::uint32_t codePoint)
+            {
+                if (codePoint < LatinCharacterCount)
+                {
+                    const float advance = m_latinAdvances[codePoint];
+                    if (!std::isnan(advance))
+                        return advance;
+                }
+
+                return loadAdvance(codePoint);
+            }
+
+            float getKerning(std::uint32_t first, std::uint32_t second)
+            {
+                if ((first < LatinCharacterCount) && (second < LatinCharacterCount) && m_latinKerning[first])
+                {
+                    const float kerning = m_latinKerning[first][second];
+                    if (!std::isnan(kerning))
+                        return kerning;
+                }
+
+                return loadKerning(first, second);
+            }
+
+            // Returns the width of the text up to the first newline character
+            float getLineWidth(const sf::String& text);
+
+            // Returns the difference between the height of the first line and the line spacing (see Text::calculateExtraVerticalSpace)
+            float getExtraVerticalSpace();
+
+        private:
+
+            float loadAdvance(std::uint32_t codePoint);
+            float loadKerning(std::uint32_t first, std::uint32_t second);
+
+        private:
+
+            static constexpr std::size_t LatinCharacterCount = 256;
+
+            sf::Font& m_font;
+            const unsigned int m_characterSize;
+            const bool m_bold;
+            float m_extraVerticalSpace;
+
+            // Values that haven't been requested yet are NaN
+            std::array<float, LatinCharacterCount> m_latinAdvances;
+            std::unordered_map<std::uint32_t, float> m_otherAdvances;
+
+            // The kerning is stored per first character, rows are only allocated for characters that are actually used
+            std::array<std::unique_ptr<float[]>, LatinCharacterCount> m_latinKerning;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_METRICS_CACHE_HPP
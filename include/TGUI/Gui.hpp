@@ -28,6 +28,8 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/CommandQueue.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -177,6 +179,112 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the geometry of the widgets is merged into as few draw calls as possible
+        ///
+        /// @param enabled  Should draw calls be batched?
+        ///
+        /// Batching is disabled by default. When enabled, custom widgets have to draw via DrawBatch::draw or call
+        /// DrawBatch::flush before drawing on the target directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the geometry of the widgets is merged into as few draw calls as possible
+        ///
+        /// @return Are draw calls being batched?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made on the render target during the last call to draw
+        ///
+        /// @return Number of draw calls
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function that will be called on the gui thread during the next call to draw or processCommands
+        ///
+        /// @param command  Function to call
+        ///
+        /// This function can be called from any thread without blocking, it is the only way that other threads are allowed to
+        /// change the gui. The commands are executed in the order in which they were posted (per thread), right before the
+        /// widgets are updated. They are also executed while the window is unfocused and the widgets aren't being updated.
+        ///
+        /// @code
+        /// gui.post([chatBox, message]{ chatBox->addLine(message); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> command);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a function that will be called with the widget on the gui thread when processing commands
+        ///
+        /// @param widget    Widget that is passed to the function
+        /// @param function  Function that takes a reference to the widget as parameter
+        ///
+        /// The queue only holds a weak reference to the widget: when the widget no longer exists by the time the command is
+        /// executed then the function isn't called.
+        ///
+        /// @code
+        /// gui.post(progressBar, [value](tgui::ProgressBar& bar){ bar.setValue(value); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename WidgetType, typename Function>
+        void post(const std::shared_ptr<WidgetType>& widget, Function function)
+        {
+            std::weak_ptr<WidgetType> weakWidget = widget;
+            post([weakWidget, function]{
+                if (auto widgetPtr = weakWidget.lock())
+                    function(*widgetPtr);
+            });
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of posted commands that are executed during a single call to processCommands
+        ///
+        /// @param maxCommands  Maximum amount of commands per update, or 0 to execute all pending commands
+        ///
+        /// Limiting the amount prevents a burst of commands from making a frame take too long. Commands that aren't executed
+        /// stay in the queue until the next update. By default there is no limit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMaxCommandsPerUpdate(std::size_t maxCommands);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of posted commands that are executed during a single call to processCommands
+        ///
+        /// @return Maximum amount of commands per update, or 0 when there is no limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMaxCommandsPerUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns counters about the posted commands, e.g. to find out whether the gui can keep up with other threads
+        ///
+        /// @return Statistics of the command queue
+        ///
+        /// This function is thread-safe.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue::Statistics getCommandQueueStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the commands that were posted by other threads
+        ///
+        /// This function is called automatically by the draw function, even when the window is unfocused. You will thus only
+        /// need to call it yourself when you are not calling draw. No more commands are executed than the limit that was set
+        /// with setMaxCommandsPerUpdate.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processCommands();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -276,6 +384,54 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following the names of the containers in which it is located
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "Panel.ChildWindow.Button"
+        ///
+        /// @return Pointer to the widget that was found, or nullptr when any of the names in the path didn't exist
+        ///
+        /// @see Container::getByPath
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr getByPath(const sf::String& path) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to a widget by following the names of the containers in which it is located
+        ///
+        /// @param path  Names of the widgets separated by dots, e.g. "Panel.ChildWindow.Button"
+        ///
+        /// @return Pointer to the widget that was found, or nullptr when any of the names in the path didn't exist.
+        ///         The pointer will already be casted to the desired type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <class T>
+        typename T::Ptr getByPath(const sf::String& path) const
+        {
+            return m_container->getByPath<T>(path);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the gui keeps an index of the names of all widgets, including the ones inside containers
+        ///
+        /// @param enabled  Should the index be kept?
+        ///
+        /// Without the index, the get function has to search through all containers when the widget isn't a direct child of
+        /// the gui. With the index, widgets with a unique name are found immediately, at the cost of a little extra work when
+        /// adding, removing or renaming widgets. The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps an index of the names of all widgets, including the ones inside containers
+        ///
+        /// @return Is the index being kept?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWidgetIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -359,7 +515,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Loads the child widgets from a text file
+        /// @brief Loads the child widgets from a text file or from a binary file created with saveWidgetsToBinaryFile
         ///
         /// @param filename  Filename of the widget file
         ///
@@ -376,6 +532,15 @@ namespace tgui
         void saveWidgetsToFile(const std::string& filename);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file, which can be loaded faster than a text file
+        ///
+        /// @param filename  Filename of the widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinaryFile(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a string stream
         ///
@@ -395,12 +560,12 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Saves this the child widgets to a text file
+        /// @brief Saves the child widgets to a stream
         ///
-        /// @param stream  stringstream to which the widget file will be added
+        /// @param stream  Stream to which the widget file will be added, e.g. a file or a stream on top of your own buffer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void saveWidgetsToStream(std::stringstream& stream) const;
+        void saveWidgetsToStream(std::ostream& stream) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,6 +612,12 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        DrawBatch m_drawBatch;
+
+        // Commands posted by other threads that have to be executed during processCommands
+        CommandQueue m_commandQueue;
+        std::size_t m_maxCommandsPerUpdate = 0;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_HEIGHT_INDEX_HPP
+#define TGUI_HEIGHT_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Stores the heights of a list of items that are placed below each other, in a Fenwick tree (binary indexed tree).
+        // The total height is available immediately, while the position of an item and the item located at a given offset
+        // are found in O(log n) time. Items can be added and removed at both ends in amortized O(log n) time, the tree only
+        // has to be rebuilt when it runs out of free space on one side or when an item in the middle is removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API HeightIndex
+        {
+        public:
+
+            std::size_t getSize() const;
+
+            void pushBack(float height);
+
+            void pushFront(float height);
+
+            void popBack();
+
+            void popFront();
+
+            // Removes count items starting at the given index
+            void erase(std::size_t index, std::size_t count = 1);
+
+            // Replaces all items with the given heights
+            void assign(const std::vector<float>& heights);
+
+            void clear();
+
+            float getHeight(std::size_t index) const;
+
+            // Returns the sum of the heights of all items
+            float getTotalHeight() const;
+
+            // Returns the distance between the top of the first item and the top of the item at the given index
+            float getPosition(std::size_t index) const;
+
+            // Returns the index of the item that contains the given offset from the top of the first item.
+            // The size is returned when the offset lies below the last item.
+            std::size_t findIndex(float offset) const;
+
+        private:
+
+            // Rebuilds the tree with free space at both ends
+            void rebuild();
+
+            // Adds a value to the height in the slot and to the nodes of the tree that contain the slot
+            void addToSlot(std::size_t slot, double value);
+
+            // Returns the sum of the heights in the first count slots
+            double getSlotsPrefixSum(std::size_t count) const;
+
+        private:
+
+            std::vector<double> m_heights; // Height of every slot, slots that aren't in use have a height of 0
+            std::vector<double> m_tree;    // One-based Fenwick tree over the slots
+            std::size_t m_firstSlot = 0;
+            std::size_t m_size = 0;
+            double m_totalHeight = 0;
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_HEIGHT_INDEX_HPP
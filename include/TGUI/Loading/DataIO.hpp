@@ -31,6 +31,7 @@
 #include <TGUI/Config.hpp>
 #include <SFML/System/String.hpp>
 #include <sstream>
+#include <ostream>
 #include <memory>
 #include <vector>
 #include <string>
@@ -86,14 +87,122 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Contents of the widget file, which only has to remain valid while this function is executing
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data isn't a valid widget file
+        ///
+        /// This is faster than parsing from a stream, as the characters are read directly from the buffer.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes a widget file one section at a time, so that the whole tree of nodes never has to exist in memory
+        ///
+        /// The output is identical to what emit would write for a root node with the same properties and children.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API StreamWriter
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// @param stream  Stream to which the widget file will be written, which has to outlive the writer
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit StreamWriter(std::ostream& stream);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a property of the root node
+            ///
+            /// @param key    Name of the property
+            /// @param value  Serialized value of the property
+            ///
+            /// The properties of the root node have to be written before the first section.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeProperty(const std::string& key, const sf::String& value);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Writes a child of the root node, including all its properties and nested sections
+            ///
+            /// @param node  Node to write, which can be destroyed as soon as this function returns
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void writeSection(const Node& node);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            // Writes a section with the given indentation, which is restored when the function returns
+            void writeSection(const Node& node, std::string& indentation);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::ostream& m_stream;
+            bool m_propertiesWritten = false;
+            bool m_sectionsWritten = false;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
-        /// @param rootNode Root node of the tree of nodes that is to be converted to a string stream
+        /// @param rootNode Root node of the tree of nodes that is to be converted to text
         /// @param stream   Stream to which the widget file will be added
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+        static void emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the data starts with the header of a binary widget file
+        ///
+        /// @param data  Contents of the file
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return True when the data was created with emitBinary, false when it should be parsed as a text file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a binary widget file that was created with emitBinary
+        ///
+        /// @param data  Contents of the file, which has to remain valid while this function is executing
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data isn't a valid binary widget file
+        ///
+        /// The binary file contains the same tree as a text file, but names and values are stored only once in a string table
+        /// and nodes refer to each other with indices. There is thus no tokenizing or unescaping to be done when loading it and
+        /// the strings are directly copied from the data (which is typically a memory-mapped file) into the nodes.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parseBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Emits the widget file in binary form
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted
+        /// @param stream   Stream to which the binary widget file will be written, which should be opened in binary mode
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::ostream& stream);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
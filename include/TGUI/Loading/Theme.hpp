@@ -28,6 +28,7 @@
 
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -121,6 +122,19 @@ namespace tgui
         const std::string& getPrimary() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading all images of the theme on background threads
+        ///
+        /// @param progressCallback  Optional function that is called on the gui thread each time an image has been loaded,
+        ///                          with the amount of images that were handled so far and the total amount of images
+        ///
+        /// Widgets can already be created while the images are being loaded, but the first widget that needs an image that
+        /// isn't loaded yet will load it itself. The images are kept in memory until TextureManager::releasePreloadedTextures
+        /// is called. See TextureManager::preloadTexturesAsync for more information.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadTexturesAsync(std::function<void(std::size_t loadedCount, std::size_t totalCount)> progressCallback = nullptr);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the function that will load the widget theme data
         ///
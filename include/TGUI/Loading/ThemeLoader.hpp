@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 #include <SFML/System/String.hpp>
 #include <memory>
 #include <string>
@@ -38,6 +39,8 @@
 
 namespace tgui
 {
+    struct RendererData;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for theme loader implementations
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,6 +88,29 @@ namespace tgui
         virtual bool canLoad(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the renderer data from the theme
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation creates the renderer data from the property-value pairs returned by the load function.
+        ///
+        /// @return New renderer data that the caller is free to modify
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<RendererData> loadRenderer(const std::string& primary, const std::string& secondary);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the images that are used by the theme, so that they can be loaded in advance
+        ///
+        /// @param primary  Primary parameter of the loader
+        ///
+        /// @return Ids of the textures that the renderers may load. The default implementation returns an empty list.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<sf::String> getTextureIds(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -96,6 +122,7 @@ namespace tgui
     /// This loader will be able to extract the data from these files.
     ///
     /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// Theme files that were written with DataIO::emitBinary are also accepted, they are parsed faster than text files.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
     {
@@ -136,6 +163,35 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the renderer data from the theme file
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// The sections are converted to renderer data only once when the theme file is loaded, this function returns a copy
+        /// of the cached data. Nested sections and references to other sections are stored as renderer data instead of text.
+        ///
+        /// @return New renderer data that the caller is free to modify
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<RendererData> loadRenderer(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the filenames of all textures in the theme file
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// @return Ids of the textures that appear in any section of the theme file
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<sf::String> getTextureIds(const std::string& filename) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -160,9 +216,18 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
 
-        friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads and parses the theme file, with the filenames inside it made relative to the location of the theme file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> parseThemeFile(const std::string& filename) const;
+
+
+        static std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> m_renderersCache;
+        static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache; // Only filled when calling load, which parses the file again
+        static std::map<std::string, std::vector<sf::String>> m_textureIdsCache;
+
+        friend struct DefaultThemeLoaderTest; // Used for testing m_renderersCache and m_propertiesCache
     };
 
 
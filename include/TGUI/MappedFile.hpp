@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MAPPED_FILE_HPP
+#define TGUI_MAPPED_FILE_HPP
+
+#include <TGUI/Global.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Read-only view on the contents of a file
+        ///
+        /// The file is mapped into memory when the platform supports it, so that its contents are only read from disk when
+        /// they are accessed. On other platforms the file is read into a buffer instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API MappedFile
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Default constructor that creates an empty view
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            MappedFile() = default;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Destructor that unmaps the file
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~MappedFile();
+
+
+            // The view cannot be copied
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Maps a file into memory, replacing the file that was opened before
+            ///
+            /// @param filename  Filename of the file to open
+            ///
+            /// @return True when the file was opened, false when it couldn't be opened
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool open(const std::string& filename);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Unmaps the file
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void close();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the contents of the file
+            ///
+            /// @return Pointer to the first byte of the file, or nullptr when no file is opened or the file is empty
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            const char* getData() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the size of the file
+            ///
+            /// @return Amount of bytes that can be accessed via getData
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getSize() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            const char* m_data = nullptr;
+            std::size_t m_size = 0;
+            void* m_mapping = nullptr; // Platform specific handle, nullptr when the contents are stored in m_buffer
+            std::vector<char> m_buffer;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MAPPED_FILE_HPP
@@ -59,11 +59,7 @@ namespace tgui
                 rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
 
             for (const auto& nestedProperty : rendererNode->children)
-            {
-                std::stringstream ss;
-                DataIO::emit(nestedProperty, ss);
-                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {sf::String{"{\n" + ss.str() + "}"}};
-            }
+                rendererData->propertyValuePairs[toLower(nestedProperty->name)] = {createFromDataIONode(nestedProperty.get())};
 
             return rendererData;
         };
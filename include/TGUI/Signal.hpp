@@ -141,6 +141,19 @@ namespace tgui
         void disconnectAll();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any signal handlers are connected to this signal
+        ///
+        /// @return True when at least one signal handler is connected
+        ///
+        /// This can be used to avoid calculating expensive parameters of the signal when nobody would receive them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasConnections() const
+        {
+            return !m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Call all connected signal handlers
         ///
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SPATIAL_INDEX_HPP
+#define TGUI_SPATIAL_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Uniform grid that is used by containers to quickly find the widgets that could be below the mouse.
+        // The grid also keeps track of the z-order of the widgets, so that the top widget can be found first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API SpatialIndex
+        {
+        public:
+
+            explicit SpatialIndex(float cellSize = 64);
+
+            float getCellSize() const;
+
+            // Adds the widget on top of all other widgets. Widgets that are unbounded are always returned by query.
+            void insert(Widget* widget, FloatRect bounds, bool unbounded);
+
+            // Updates the bounds of a widget that was already inserted, without changing its z-order
+            void update(Widget* widget, FloatRect bounds, bool unbounded);
+
+            void remove(Widget* widget);
+
+            void clear();
+
+            void moveToFront(Widget* widget);
+
+            void moveToBack(Widget* widget);
+
+            // Gives all widgets a z-order that matches their index in the list, the first widget lies behind all others
+            void setZOrder(const std::vector<std::shared_ptr<Widget>>& widgets);
+
+            // Returns the widgets that might be located at the given position, with the top widget first
+            const std::vector<Widget*>& query(Vector2f pos) const;
+
+            // Returns the widgets that might overlap with the given area, with the bottom widget first
+            const std::vector<Widget*>& query(const FloatRect& area) const;
+
+        private:
+
+            struct Entry
+            {
+                int left = 0;
+                int top = 0;
+                int right = -1;
+                int bottom = -1;
+                bool unbounded = false;
+                std::int64_t zOrder = 0;
+            };
+
+            void addToCells(Widget* widget, const Entry& entry);
+            void removeFromCells(Widget* widget, const Entry& entry);
+            void calculateCells(Entry& entry, FloatRect bounds, bool unbounded) const;
+
+            static std::uint64_t getCellKey(int x, int y);
+
+        private:
+
+            float m_cellSize;
+
+            std::unordered_map<std::uint64_t, std::vector<Widget*>> m_cells;
+            std::unordered_map<Widget*, Entry> m_entries;
+            std::vector<Widget*> m_unboundedWidgets;
+
+            // Widgets moved to the front get a higher value than all others, widgets moved to the back get a lower one
+            std::int64_t m_topZOrder = 0;
+            std::int64_t m_bottomZOrder = 0;
+
+            mutable std::vector<Widget*> m_queryResult;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SPATIAL_INDEX_HPP
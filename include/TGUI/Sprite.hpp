@@ -30,7 +30,6 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Color.hpp>
-#include <TGUI/Aurora/SmartPtr/CopiedPtr.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
@@ -234,13 +233,22 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Shifts the texture coordinates after the image was moved to another atlas page or to its own texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAtlasTexCoords() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         Vector2f    m_size;
         Texture     m_texture;
-        aurora::CopiedPtr<sf::Texture> m_svgTexture;
-        std::vector<sf::Vertex> m_vertices;
+        std::shared_ptr<sf::Texture> m_svgTexture; // Shared with other sprites showing the same svg at the same size
+        mutable std::shared_ptr<sf::Texture> m_previousSvgTexture; // Shown stretched while m_svgTexture is still being rasterized
+        mutable std::shared_ptr<sf::Texture> m_atlasTexture; // Atlas page for which the texture coordinates of the vertices were calculated
+        mutable sf::Vector2f m_atlasOffset; // Location of the image in m_atlasTexture that was added to the texture coordinates
+        mutable std::vector<sf::Vertex> m_vertices;
 
         FloatRect   m_visibleRect;
 
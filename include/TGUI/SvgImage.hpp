@@ -29,6 +29,8 @@
 #include <TGUI/Vector2f.hpp>
 
 #include <SFML/System/String.hpp>
+#include <cstdint>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -88,6 +90,19 @@ namespace tgui
         void rasterize(sf::Texture& texture, sf::Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Draws the image to a pixel buffer
+        ///
+        /// @param size  Size of the image to draw
+        ///
+        /// @return RGBA pixels of the image, or an empty buffer when no svg was loaded
+        ///
+        /// Unlike rasterize, this function doesn't need an OpenGL context and it can be called from multiple threads at once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::uint8_t> rasterizeToPixels(sf::Vector2u size) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         NSVGimage* m_svg = nullptr;
@@ -32,6 +32,8 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -315,6 +317,12 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the glyph quads that are used to draw the text when draw calls are being batched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -323,6 +331,9 @@ namespace tgui
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_verticesNeedUpdate = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,99 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_ROPE_HPP
+#define TGUI_TEXT_ROPE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <cstdint>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        struct TextRopeNode;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Stores text as a balanced tree (a treap) of small chunks. Inserting or erasing characters only changes the chunks
+        // around the edited position, so edits, character lookups and extracting part of the text take O(log n) time plus
+        // the amount of characters that are inserted or extracted, instead of moving the rest of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API TextRope
+        {
+        public:
+
+            TextRope();
+            TextRope(const sf::String& text);
+            TextRope(const TextRope& other);
+            TextRope(TextRope&& other) noexcept;
+            ~TextRope();
+
+            TextRope& operator=(const TextRope& other);
+            TextRope& operator=(TextRope&& other) noexcept;
+
+            // Returns the amount of characters in the text
+            std::size_t getSize() const;
+
+            bool isEmpty() const;
+
+            // Returns the character at the given index, which has to be smaller than the size
+            std::uint32_t operator[](std::size_t index) const;
+
+            // Inserts the text in front of the character at the given position
+            void insert(std::size_t position, const sf::String& text);
+
+            // Removes count characters starting at the given position. Characters behind the end of the text are ignored.
+            void erase(std::size_t position, std::size_t count = sf::String::InvalidPos);
+
+            void clear();
+
+            sf::String substring(std::size_t position, std::size_t count = sf::String::InvalidPos) const;
+
+            sf::String toString() const;
+
+            // Returns the index of the first occurrence of the character at or after the start position.
+            // Returns sf::String::InvalidPos when the character isn't found.
+            std::size_t find(std::uint32_t character, std::size_t start = 0) const;
+
+            // Returns the index of the last occurrence of the character in front of the end position.
+            // Returns sf::String::InvalidPos when the character isn't found.
+            std::size_t findLast(std::uint32_t character, std::size_t end) const;
+
+        private:
+
+            std::unique_ptr<TextRopeNode> m_root;
+            std::uint32_t m_randomState = 2463534242u; // State of the generator of the node priorities
+        };
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_ROPE_HPP
@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,25 +48,24 @@ namespace tgui
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::unique_ptr<sf::Image> image;
-        std::unique_ptr<SvgImage> svgImage;
+        std::unique_ptr<sf::Image> image; // Null when the TextureManager doesn't keep images in memory after uploading them
+        std::vector<bool> alphaMask; // One bit per pixel that is set when the pixel isn't fully transparent, when image is null
+        std::shared_ptr<SvgImage> svgImage; // Shared with background rasterizations that may outlive the texture data
         sf::Texture texture;
         sf::IntRect rect;
 
+        std::shared_ptr<sf::Texture> atlasTexture; // Page shared with other images when stored in the atlas, texture is empty then
+        sf::IntRect atlasRect; // Location of the image inside the atlas page
+
+        // Only used when the data was loaded by the TextureManager
+        sf::String filename;
+        unsigned int users = 0; // Amount of Texture objects sharing this data
+
 #ifndef TGUI_NEXT
         sf::Shader* shader = nullptr;
 #endif
     };
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    // Wrapper around TextureData to be used in TextureManager
-    struct TGUI_API TextureDataHolder
-    {
-        std::shared_ptr<TextureData> data;
-        std::string  filename;
-        unsigned int users = 0;
-    };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
@@ -29,9 +29,15 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <SFML/System/Time.hpp>
+#include <functional>
 #include <memory>
 #include <list>
 #include <map>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +45,11 @@ namespace tgui
 {
     class Texture;
 
+    namespace priv
+    {
+        class WorkerPool;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API TextureManager
@@ -79,10 +90,359 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the svg image of the texture data, rasterized at the given size
+        ///
+        /// @param textureData  Texture data containing the svg image
+        /// @param size         Size of the rasterized image
+        ///
+        /// Sprites that show the same svg image at the same size share a single texture. The image is only rasterized when
+        /// no texture with this size was found in the cache.
+        ///
+        /// @return Rasterized image or nullptr when the data contains no svg or the image couldn't be rasterized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Texture> getSvgTexture(const std::shared_ptr<TextureData>& textureData, sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that rasterized svg images can use in the cache
+        ///
+        /// @param bytes  Maximum amount of bytes of the pixels in the cached textures (16 MiB by default)
+        ///
+        /// When the limit is exceeded, the least recently used textures are removed from the cache.
+        /// Textures that are still being used by a sprite are never removed, they don't cost extra memory to keep.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setSvgCacheLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that rasterized svg images can use in the cache
+        ///
+        /// @return Maximum amount of bytes of the pixels in the cached textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSvgCacheLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory used by the rasterized svg images in the cache
+        ///
+        /// @return Amount of bytes of the pixels in the cached textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSvgCacheMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a rasterized svg image could be reused from the cache
+        ///
+        /// @return Amount of cache hits since the program started
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSvgCacheHitCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times an svg image had to be rasterized because it wasn't found in the cache
+        ///
+        /// @return Amount of cache misses since the program started
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getSvgCacheMissCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all rasterized svg images from the cache
+        ///
+        /// Sprites keep using the texture they already have, but new sprites will no longer share it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearSvgCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether svg images are rasterized on background threads
+        ///
+        /// @param enabled  Should svg images be rasterized asynchronously?
+        ///
+        /// When enabled, a sprite that is given a new size keeps showing its previous rasterization (stretched to the new size)
+        /// until the pixels for the new size are ready. The pixels are copied to the texture on the gui thread in Gui::draw.
+        /// Disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncSvgRasterizationEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether svg images are rasterized on background threads
+        ///
+        /// @return Are svg images rasterized asynchronously?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncSvgRasterizationEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates the textures for images that were decoded or rasterized on background threads
+        ///
+        /// @param waitForBackgroundJobs  Block until all images that are still being loaded or rasterized are finished first?
+        ///
+        /// @return Amount of textures that were created or updated
+        ///
+        /// This function is called by Gui::draw, you only need to call it yourself when e.g. showing a loading screen without
+        /// a gui. It has to be called on the thread that owns the OpenGL context.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t processPendingUploads(bool waitForBackgroundJobs = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts loading images on background threads, so that creating textures from them later won't block
+        ///
+        /// @param ids               Filenames of the images, relative paths are relative to the resource path like in Texture
+        /// @param progressCallback  Optional function that is called each time an image has been loaded (or failed to load),
+        ///                          with the amount of images that were handled so far and the total amount of images
+        ///
+        /// The files are read and decoded in parallel. The decoded images are handed over to the gui thread during
+        /// processPendingUploads (which is called from Gui::draw), the progress callback is also called from there.
+        ///
+        /// The TextureManager keeps the decoded images alive until releasePreloadedTextures is called, so that widgets created
+        /// afterwards don't have to decode them again. Images are only uploaded to the graphics card once a texture is created
+        /// from them, so only the parts of an image that are actually used end up in video memory.
+        /// Svg images are parsed on the gui thread and their textures are kept alive as well.
+        ///
+        /// @warning The image loader (see Texture::setImageLoader) is called from the background threads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void preloadTexturesAsync(const std::vector<sf::String>& ids, std::function<void(std::size_t loadedCount, std::size_t totalCount)> progressCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Drops the references to the textures and images that were loaded by preloadTexturesAsync
+        ///
+        /// Textures that are still used by widgets remain loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releasePreloadedTextures();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a function that is called each time an svg image was rasterized, e.g. to measure rasterization times
+        ///
+        /// @param callback  Function that receives the size of the image, the time it took to rasterize it and the time
+        ///                  between requesting the image and the texture being updated (which includes waiting in the queue)
+        ///
+        /// The callback is always called on the gui thread, after the texture has been updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setSvgRasterizationCallback(std::function<void(sf::Vector2u size, sf::Time rasterizationTime, sf::Time latency)> callback);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether loaded images are packed together in a few large textures
+        ///
+        /// @param enabled  Should images that are loaded from now on be placed in the texture atlas?
+        ///
+        /// When all images of a theme are part of the same texture, widgets can be drawn without switching textures in between,
+        /// which allows the draw calls to be batched. Images that are too large to fit in an atlas page and svg images are
+        /// still given their own texture. Enabling smoothing on a texture moves its image out of the atlas.
+        ///
+        /// Images that were already loaded are not affected by this setting. Disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether loaded images are packed together in a few large textures
+        ///
+        /// @return Is the texture atlas used for newly loaded images?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of the textures that are created for the atlas
+        ///
+        /// @param size  Size of new atlas pages, limited by the maximum texture size of the graphics card (default is 2048)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of the textures that are created for the atlas
+        ///
+        /// @return Size of new atlas pages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getAtlasPageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that the atlas currently consists of
+        ///
+        /// @return Amount of atlas pages that are still used by at least one image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getAtlasPageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Gives an image that is stored in the atlas its own texture
+        ///
+        /// @param textureData  Texture data that should no longer share its texture with other images
+        ///
+        /// This is used when a texture needs different settings than the atlas page, e.g. when enabling smoothing.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromAtlas(const std::shared_ptr<TextureData>& textureData);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the pixels of loaded images remain in memory after the texture has been created
+        ///
+        /// @param keep  Should images that are loaded from now on keep a copy of their pixels in RAM?
+        ///
+        /// The pixels are only needed to find out which parts of the image are transparent, e.g. for Picture::ignoreMouseEvents
+        /// and for buttons that ignore clicks on transparent parts. When the images are not kept, a mask with one bit per
+        /// pixel is stored instead, which is 32 times smaller.
+        ///
+        /// Images are kept by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setKeepImagesAfterUpload(bool keep);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the pixels of loaded images remain in memory after the texture has been created
+        ///
+        /// @return Are images that are loaded from now on kept in RAM?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getKeepImagesAfterUpload();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of RAM used to store the pixels and transparency masks of the loaded images
+        ///
+        /// @return Amount of bytes used by all loaded images, excluding the textures on the graphics card
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getImageMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the threads that do work in the background, which are started on first use
+        ///
+        /// The pool is shared by the image loading, svg rasterization and the sorting of large lists in ListView.
+        ///
+        /// @return Worker pool shared by the whole gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static priv::WorkerPool& getWorkerPool();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the least recently used textures that are no longer used by sprites until the cache fits within its limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void shrinkSvgCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all rasterizations of an svg image from the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeSvgFromCache(const SvgImage* svgImage);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the image to a free spot in one of the atlas pages, returns false if it couldn't be placed in the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool addToAtlas(TextureData& data);
+
+
+        struct AtlasPage;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves space in an atlas page with the skyline bottom-left heuristic, returns false if the page is too full
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool allocateAtlasSpace(AtlasPage& page, sf::Vector2u size, sf::Vector2u& position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Packs the images that are still stored in the page into a new page texture, returns false if they didn't fit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool compactAtlasPage(AtlasPage& page);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the space of the image in its atlas page as free and removes the image from the page
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void releaseAtlasSpace(TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destroys the atlas pages of which all images were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeUnusedAtlasPages();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Rasterized svg image, stored in the cache
+        struct SvgCacheEntry
+        {
+            const SvgImage* svgImage;
+            sf::Vector2u size;
+            std::shared_ptr<sf::Texture> texture;
+        };
+
+        using SvgCacheKey = std::tuple<const SvgImage*, unsigned int, unsigned int>;
+
+        // Images are only shared when the exact same part of the same file is loaded
+        struct ImageKey
+        {
+            sf::String filename;
+            sf::IntRect partRect;
+
+            bool operator==(const ImageKey& other) const
+            {
+                return (filename == other.filename) && (partRect == other.partRect);
+            }
+        };
+
+        struct ImageKeyHash
+        {
+            std::size_t operator()(const ImageKey& key) const;
+        };
+
+        // Horizontal line in an atlas page above which no image has been placed yet
+        struct AtlasSkylineSegment
+        {
+            unsigned int x;
+            unsigned int y;
+            unsigned int width;
+        };
+
+        // Large texture in which many images are stored. Space of removed images is reclaimed by repacking the page.
+        struct AtlasPage
+        {
+            std::shared_ptr<sf::Texture> texture;
+            unsigned int size;
+            std::vector<AtlasSkylineSegment> skyline; // Sorted from left to right, covers the entire width of the page
+            std::size_t usedArea = 0; // Padded area of the images that are still stored in the page
+            bool fragmented = false; // Images were removed from the page since it was last packed
+        };
+
+        static std::unordered_map<ImageKey, std::shared_ptr<TextureData>, ImageKeyHash> m_imageMap;
+        static bool m_keepImagesAfterUpload;
+
+        static std::list<SvgCacheEntry> m_svgCache; // Most recently used textures are at the front
+        static std::map<SvgCacheKey, std::list<SvgCacheEntry>::iterator> m_svgCacheIndex;
+        static std::size_t m_svgCacheMemoryUsage;
+        static std::size_t m_svgCacheLimit;
+        static std::size_t m_svgCacheHitCount;
+        static std::size_t m_svgCacheMissCount;
+
+        static bool m_asyncSvgRasterization;
+        static std::function<void(sf::Vector2u, sf::Time, sf::Time)> m_svgRasterizationCallback;
+
+        static CommandQueue m_uploadQueue; // Filled by the worker threads, executed during Gui::draw
+        static std::unique_ptr<priv::WorkerPool> m_workerPool;
+
+        static std::map<sf::String, std::shared_ptr<const sf::Image>> m_preloadedImages;
+        static std::vector<std::shared_ptr<TextureData>> m_preloadedTextures; // Svg images only, each of these counts as a user of the data
+
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasPageSize;
+        static std::vector<AtlasPage> m_atlasPages;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
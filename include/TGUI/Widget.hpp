@@ -516,6 +516,25 @@ namespace tgui
         bool isFocusable() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widget keeps being updated while it lies outside the visible area of its parent
+        ///
+        /// @param updated  Should the widget be updated when it is scrolled or moved out of view?
+        ///
+        /// By default all widgets are updated every frame. Widgets for which this is disabled won't advance their animations
+        /// (or blink their caret) while their parent doesn't show them, which saves time in containers with many widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setUpdatedWhileOffscreen(bool updated);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget keeps being updated while it lies outside the visible area of its parent
+        ///
+        /// @return Is the widget updated when it is scrolled or moved out of view?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdatedWhileOffscreen() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the widget can currently gain focus
         /// @return Can the widget be focused right now?
@@ -540,6 +559,15 @@ namespace tgui
         virtual void setParent(Container* parent);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Sets the widget that draws this widget as part of itself, e.g. the scrollbar inside a list box.
+        /// Such a widget has no parent, so changes to it are reported to the parent of the owner instead.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheOwner(Widget* owner);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called every frame with the time passed since the last frame.
@@ -553,6 +581,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how far outside the area given by getWidgetOffset and getFullSize the mouseOnWidget function can return true.
+        /// The margin is (0,0,0,0) for almost all widgets.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Outline getMouseAreaMargin() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -790,6 +826,12 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that the widget looks different, so that a cached image of its contents can't be reused
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateParentRenderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -837,6 +879,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // The widget that draws this widget as part of itself, when this widget isn't added to a container
+        Widget* m_renderCacheOwner = nullptr;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -847,6 +892,9 @@ namespace tgui
         // Can the widget be focused?
         bool m_focusable = true;
 
+        // Should the widget be updated when its parent doesn't show it?
+        bool m_offscreenUpdates = true;
+
         // Keep track of the elapsed time.
         sf::Time m_animationTimeElapsed;
 
@@ -856,6 +904,10 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to true for widgets that can be drawn or that can react to the mouse outside the area given by
+        // getWidgetOffset and getFullSize (e.g. the open menu of a menu bar), so that the parent never skips them
+        bool m_unboundedArea = false;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -885,7 +937,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Container; // Container accesses m_mouseDown, m_draggableWidget, m_unboundedArea, m_offscreenUpdates, save and load
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/HeightIndex.hpp>
 #include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +326,14 @@ namespace tgui
         bool getNewLinesBelowOthers() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -380,7 +389,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Updates the scrollbar after the space used by the lines changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
@@ -464,6 +473,9 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // The height of every line, to find the visible lines without having to loop over all lines
+        priv::HeightIndex m_lineHeights;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
@@ -367,6 +367,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how far outside the child window the mouse can be to still be on the resizable borders.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Outline getMouseAreaMargin() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +176,24 @@ namespace tgui
         bool addItem(const sf::String& itemName, const sf::String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional unique ids for the items, either empty or containing an id for every item
+        ///
+        /// This is faster than calling addItem for every item, as the list is only resized once.
+        ///
+        /// @return
+        ///         - true when all items were successfully added
+        ///         - false when the list became full before all items were added
+        ///
+        /// @see addItem
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item from the list
         ///
@@ -499,6 +517,24 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the combo box keeps hash tables to find items by their name or id
+        ///
+        /// @param enabled  Should the lookup index be kept?
+        ///
+        /// @see ListBox::setLookupIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLookupIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the combo box keeps hash tables to find items by their name or id
+        ///
+        /// @return Is the lookup index being kept?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLookupIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
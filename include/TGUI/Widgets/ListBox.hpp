@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -126,6 +127,24 @@ namespace tgui
         bool addItem(const sf::String& itemName, const sf::String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional unique ids for the items, either empty or containing an id for every item
+        ///
+        /// This is faster than calling addItem for every item, as the scrollbar is only updated once.
+        ///
+        /// @return
+        ///         - true when all items were successfully added
+        ///         - false when the list box became full before all items were added
+        ///
+        /// @see addItem
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list box
         ///
@@ -466,6 +485,35 @@ namespace tgui
         bool containsId(const sf::String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the list box keeps hash tables to find items by their name or id
+        ///
+        /// @param enabled  Should the lookup index be kept?
+        ///
+        /// Without the index, functions that take the name or id of an item (e.g. setSelectedItemById, getItemById, contains,
+        /// removeItem) have to compare the string with every item. With the index, the items are found immediately, at the
+        /// cost of extra memory and a little extra work when items are added, removed or changed.
+        /// This is worth enabling for lists with thousands of items that are often searched. The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLookupIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list box keeps hash tables to find items by their name or id
+        ///
+        /// @return Is the lookup index being kept?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLookupIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -557,6 +605,30 @@ namespace tgui
         Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given name, or -1 when no item has that name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndex(const sf::String& itemName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given id, or -1 when no item has that id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndexById(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the lookup index again with all items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildLookupIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the Text object for a new item and adds it at the end of the list, without updating the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendItem(const sf::String& itemName, const sf::String& id);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the colors and text style of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +684,11 @@ namespace tgui
         std::vector<Text>       m_items;
         std::vector<sf::String> m_itemIds;
 
+        // Optional hash tables that map the names and ids to the indices of the items that have them (in increasing order)
+        std::unordered_map<sf::String, std::vector<std::size_t>, priv::StringHash> m_itemNameIndex;
+        std::unordered_map<sf::String, std::vector<std::size_t>, priv::StringHash> m_itemIdIndex;
+        bool m_lookupIndexEnabled = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
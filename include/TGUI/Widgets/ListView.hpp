@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -47,6 +48,15 @@ namespace tgui
         typedef std::shared_ptr<ListView> Ptr; ///< Shared widget pointer
         typedef std::shared_ptr<const ListView> ConstPtr; ///< Shared constant widget pointer
 
+        /// Function that returns the text of an item in a given column, used when the list view is in virtual mode
+        typedef std::function<sf::String(std::size_t index, std::size_t column)> VirtualItemProvider;
+
+        /// Function that returns whether the left text should be placed before the right text when sorting items
+        typedef std::function<bool(const sf::String& left, const sf::String& right)> ItemComparator;
+
+        /// Function that returns whether the item with the given index should be shown
+        typedef std::function<bool(std::size_t index)> ItemFilter;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The text alignment for all texts within a column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +67,15 @@ namespace tgui
             Right   ///< Place the text on the right side (e.g. for numbers)
         };
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief How the texts in a column are compared when sorting the items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class SortMode
+        {
+            Lexicographic, ///< Compare the texts character by character (default)
+            Numeric        ///< Compare the numbers in the texts, texts that don't start with a number are treated as 0
+        };
+
         struct Item
         {
             std::vector<Text> texts;
@@ -310,6 +329,133 @@ namespace tgui
         void removeAllItems();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Puts the list view in virtual mode, where the items are not stored inside the list view
+        ///
+        /// @param itemCount  Amount of items in the list
+        /// @param provider   Function that is called to get the text of an item in a column
+        ///
+        /// In virtual mode, texts are only created for the items that are visible, which allows showing a huge amount of items.
+        /// The provider is called again for an item when it becomes visible after scrolling, so it has to be cheap.
+        /// The items that existed before are removed. Functions such as addItem, changeItem and removeItem can't be used
+        /// in virtual mode, call setVirtualItemCount when the items change. Items don't have icons in virtual mode and they
+        /// aren't saved when the list view is saved to a file. Calling removeAllItems leaves virtual mode.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, const VirtualItemProvider& provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of items in virtual mode
+        ///
+        /// @param itemCount  Amount of items in the list
+        ///
+        /// The texts of the visible items are requested from the provider again, so this function should also be called when
+        /// the contents of the items changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list view is in virtual mode
+        ///
+        /// @return Was setVirtualItems called (and not yet undone with removeAllItems)?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isVirtual() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the items on the texts in a column
+        ///
+        /// @param column     Index of the column to sort on
+        /// @param mode       How the texts are compared
+        /// @param ascending  Should the items be shown from smallest to largest?
+        ///
+        /// The sort is stable: items with the same text remain in the order in which they were added.
+        /// Sorting only changes the order in which the items are shown, the indices of the items (as used in functions like
+        /// getItem, changeItem and setSelectedItem) remain the same. Items that are added or changed later are placed at the
+        /// correct position. Large lists are sorted on multiple threads.
+        ///
+        /// Sorting is not supported in virtual mode, the provider should return the items in the wanted order instead.
+        ///
+        /// @code
+        /// tgui::ListView* view = listView.get();
+        /// listView->connect("HeaderClicked", [view](int column){
+        ///     view->sortItems(column, tgui::ListView::SortMode::Lexicographic,
+        ///                     (view->getSortColumn() != column) || !view->isSortedAscending());
+        /// });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(std::size_t column, SortMode mode = SortMode::Lexicographic, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the items on the texts in a column, using a custom comparison function
+        ///
+        /// @param column      Index of the column to sort on
+        /// @param comparator  Function that returns true when the left text should be placed before the right text
+        /// @param ascending   Should the order of the comparator be used? When false, the order is reversed.
+        ///
+        /// @warning Large lists are sorted on multiple threads, so the comparator may be called from several threads at once.
+        ///
+        /// @see sortItems(std::size_t, SortMode, bool)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sortItems(std::size_t column, const ItemComparator& comparator, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops sorting the items, they will be shown in the order in which they were added again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeSorting();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the column on which the items are sorted
+        ///
+        /// @return Index of the column passed to sortItems, or -1 when the items aren't sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the items are sorted in ascending order
+        ///
+        /// @return Value of the ascending parameter that was passed to sortItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortedAscending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the filter returns true
+        ///
+        /// @param filter  Function that is called with the index of each item, or nullptr to show all items again
+        ///
+        /// The filter is also called for items that are added or changed later. If the condition inside the filter changes
+        /// (e.g. because the user typed a different search text), then this function has to be called again.
+        /// The selected item is deselected when it gets hidden by the filter.
+        ///
+        /// Filtering is not supported in virtual mode, the provider should only return the wanted items instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemFilter(const ItemFilter& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that are shown
+        ///
+        /// @return Amount of items that pass the filter, which equals getItemCount() when there is no filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDisplayedItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the item that is shown at a given position in the list
+        ///
+        /// @param row  Position of the item in the list as it is shown, taking sorting and filtering into account
+        ///
+        /// @return Index of the item (to be used in e.g. getItem), or -1 when the row is too high
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getDisplayedItemIndex(std::size_t row) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list view
         ///
@@ -600,6 +746,14 @@ namespace tgui
         Scrollbar::Policy getHorizontalScrollbarPolicy() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -695,7 +849,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Text createText(const sf::String& caption);
+        Text createText(const sf::String& caption) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -710,6 +864,74 @@ namespace tgui
         void setItemColor(std::size_t index, const Color& color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color that the texts of an item should have, depending on whether it is selected or hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getItemTextColor(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Requests the texts of the visible items from the provider in virtual mode. The texts of items that are no longer
+        // visible are reused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the item that has to be drawn at a given row, which in virtual mode is one of the items that were loaded
+        // for the visible area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Item& getDrawnItem(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the items are sorted or filtered, in which case m_displayedItems and m_itemRows are used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemOrderActive() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row at which an item is shown, or -1 when the item is hidden by the filter or the index is invalid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowOfItem(int index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the text of the item in the column on which the list is sorted, or an empty string if the item has no such text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& getSortText(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns true when the item with the left index has to be shown above the item with the right index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool compareItems(std::size_t left, std::size_t right) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Filters and sorts all items again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemOrder();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a row for an item that was added or changed, at the position where it belongs when the items are sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertItemRow(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the row of an item, without changing the indices of the other items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeItemRow(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the column below the mouse when it is on top of the header, or -1 when there is no column there
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getColumnIndexBelowMouse(float mouseLeft) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calculate the width of the column based on its caption when no column width was provided
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,6 +1023,7 @@ namespace tgui
         SignalInt onItemSelect  = {"ItemSelected"};   ///< An item was selected in the list view. Optional parameter: selected item index (-1 when deselecting)
         SignalInt onDoubleClick = {"DoubleClicked"};  ///< An item was double clicked. Optional parameter: selected item index
         SignalInt onRightClick  = {"RightClicked"};   ///< Right mouse clicked. Optional parameter: index of item below mouse (-1 when not on top of item)
+        SignalInt onHeaderClick = {"HeaderClicked"};  ///< The header was clicked. Optional parameter: column index
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -809,6 +1032,22 @@ namespace tgui
         std::vector<Column> m_columns;
         std::vector<Item>   m_items;
 
+        // In virtual mode the items are requested from the provider and only the visible items are stored
+        VirtualItemProvider       m_virtualItemProvider;
+        std::size_t               m_virtualItemCount = 0;
+        mutable std::vector<Item> m_virtualItems;
+        mutable std::size_t       m_virtualItemsStart = 0; // Index of the first item in m_virtualItems
+
+        // When the items are sorted or filtered, the items are shown in the order of m_displayedItems instead of the order of
+        // m_items. The items themselves are never moved, so their indices remain valid.
+        std::vector<std::size_t> m_displayedItems; // Index of the item shown at each row
+        std::vector<int>         m_itemRows;       // Row at which each item is shown, -1 when hidden by the filter
+        ItemFilter               m_itemFilter;
+        ItemComparator           m_sortComparator;
+        SortMode                 m_sortMode = SortMode::Lexicographic;
+        int                      m_sortColumn = -1;
+        bool                     m_sortAscending = true;
+
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
 
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextRope.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -383,6 +384,14 @@ namespace tgui
         void enableMonospacedFontOptimization(bool enable = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -436,6 +445,17 @@ namespace tgui
     protected:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // A line that is displayed in the text box, which is either a paragraph or a part of it when word-wrap is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Line
+        {
+            std::size_t start;  // Index in m_text of the first character on the line
+            std::size_t length; // Amount of characters on the line
+            float width;        // Only calculated when the widths are needed to find the largest line
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will search after which character the caret should be placed. It will not change the caret position.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -448,6 +468,24 @@ namespace tgui
         std::size_t getIndexOfSelectionPos(sf::Vector2<std::size_t> selectionPos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Gets the line and the position on that line of a character index in the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> getSelectionPosOfIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the characters that are displayed on a line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the character at the given position on a line, or 0 when the position lies at the end of the line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint32_t getLineCharacter(std::size_t lineIndex, std::size_t position) const;
+
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Converts the two dimensional selection positions into one dimensional positions in the text.
@@ -475,6 +513,29 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces part of the text and places the caret behind the inserted characters. Only the paragraphs that were changed
+        // are word-wrapped again, the lines of the other paragraphs are kept.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(std::size_t position, std::size_t count, const sf::String& replacement);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the paragraphs between start and end into lines, which are added to the given vector. The start has to be the
+        // beginning of a paragraph and end has to be either a newline or the end of the text. A maximum width of 0 disables
+        // word-wrap. The widths of the lines are only calculated when they are needed to find the longest line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void splitTextIntoLines(std::size_t start, std::size_t end, float maxLineWidth, std::vector<Line>& lines) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the selection and the scrollbars after the lines have changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishRearrangingText(std::size_t selectionStart, std::size_t selectionEnd);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width available for a line when word-wrap is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getWordWrapWidth() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -512,17 +573,24 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the positions of the contents of the text box.
+        // Fills the texts with the visible lines and recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculatePositions();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates which lines are currently visible.
+        // Recalculates which lines are currently visible. Only the visible lines are placed in the texts, so the positions are
+        // recalculated as well when other lines became visible.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates m_topLine and m_visibleLines based on the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleLineRange();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -575,14 +643,20 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
-        unsigned int m_textSize = 18;
-        unsigned int m_lineHeight = 24;
+        priv::TextRope m_text;
+        unsigned int   m_textSize = 18;
+        unsigned int   m_lineHeight = 24;
+
+        // The text is only converted to a single string when getText is called
+        mutable sf::String m_textString;
+        mutable bool m_textStringValid = true;
 
         // The width of the largest line
         float m_maxLineWidth;
 
-        std::vector<sf::String> m_lines;
+        // The lines don't contain a copy of the text, they only refer to the characters in m_text
+        std::vector<Line> m_lines;
+        bool m_lineWidthsValid = false;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
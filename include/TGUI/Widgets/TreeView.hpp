@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,8 +61,10 @@ namespace tgui
             Text text;
             unsigned depth = 0;
             bool expanded = true;
+            bool populateOnExpand = false; ///< Children are requested via the Populate signal when the node is first expanded
             Node* parent;
             std::vector<std::shared_ptr<Node>> nodes;
+            std::unordered_map<sf::String, Node*, priv::StringHash> nodesByText; ///< First child node with each text
         };
 
 
@@ -142,6 +145,34 @@ namespace tgui
         bool addItem(const std::vector<sf::String>& hierarchy, bool createParents = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a new collapsed item to the tree view of which the children will only be added when it is expanded
+        ///
+        /// @param hierarchy     Hierarchy of items, with the last item being the lazy item
+        /// @param createParents Should the hierarchy be created if it did not exist yet?
+        ///
+        /// @return True when the item was added (always the case if createParents is true)
+        ///
+        /// The item is shown as a collapsed branch. The first time it gets expanded, the Populate signal is emitted with the
+        /// hierarchy of the item, which gives you the opportunity to call addItem for its children. Only items below the
+        /// populated item should be added or removed from within the callback.
+        ///
+        /// Usage example:
+        /// @code
+        /// treeView->connect("Populate", [treeView=treeView.get()](std::vector<sf::String> folder){
+        ///     for (const auto& file : listFiles(folder))
+        ///     {
+        ///         auto hierarchy = folder;
+        ///         hierarchy.push_back(file);
+        ///         treeView->addItem(hierarchy);
+        ///     }
+        /// });
+        /// treeView->addLazyItem({"Assets"});
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool addLazyItem(const std::vector<sf::String>& hierarchy, bool createParents = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands the given item
         ///
@@ -152,6 +183,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Expands all items
+        ///
+        /// Lazy items that were never expanded are left collapsed, their children are not requested by this function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void expandAll();
 
@@ -251,6 +284,14 @@ namespace tgui
         unsigned int getTextSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// This function is called when the widget is added to a container.
+        /// You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setParent(Container* parent) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -383,13 +424,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void createNode(std::vector<std::shared_ptr<Node>>& menus, Node* parent, const sf::String& text);
+        Node* createNode(Node* parent, const sf::String& text);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Node* findParentNode(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents);
+        Node* findParentNode(const std::vector<sf::String>& hierarchy, bool createParents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the node at the end of the hierarchy by looking up the text of each level in the hash table of its parent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Node* findNode(const std::vector<sf::String>& hierarchy) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a node from the tree and the visible rows that belong to it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeNode(Node* node);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Expands or collapses a single node and splices its descendants into or out of the visible rows
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void expandOrCollapseNode(Node* node, bool expandNode);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,13 +466,55 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Helper function to load the items from a text file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent);
+        void loadItems(const std::unique_ptr<DataIO::Node>& node, Node* parent);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the nodes and the descendants of expanded nodes to the list, in the order in which they are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void collectVisibleNodes(const std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether all parents of the node are expanded. A null pointer (the invisible root) is always visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isNodeVisible(const Node* node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row of a visible node
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVisibleRow(const Node* node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row directly below the last visible descendant of a visible node (or the amount of rows for the root)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowBelowNode(const Node* node) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts rows in the list of visible nodes without rebuilding it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertVisibleNodes(std::size_t row, const std::vector<std::shared_ptr<Node>>& nodes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes rows from the list of visible nodes without rebuilding it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeVisibleNodes(std::size_t row, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the texts of the visible nodes in the given range of rows and updates the width of the widest row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextPositions(std::size_t firstRow, std::size_t lastRow);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Rebuilds the list of visible items and positions the texts
+        // Updates the size, position and maximum of the scrollbars after the amount or width of the rows changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
+        void updateScrollbars();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +542,7 @@ namespace tgui
         SignalItemHierarchy onDoubleClick = {"DoubleClicked"}; ///< A leaf node was double clicked. Optional parameter: selected node
         SignalItemHierarchy onExpand = {"Expanded"};           ///< A branch node was expanded in the tree view. Optional parameter: expanded node
         SignalItemHierarchy onCollapse = {"Collapsed"};        ///< A branch node was collapsed in the tree view. Optional parameter: collapsed node
+        SignalItemHierarchy onPopulate = {"Populate"};         ///< A lazy node is expanded for the first time and needs its children. Optional parameter: lazy node
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -449,6 +551,7 @@ namespace tgui
         // This contains the nodes of the tree
         std::vector<std::shared_ptr<Node>> m_nodes;
         std::vector<std::shared_ptr<Node>> m_visibleNodes;
+        std::unordered_map<sf::String, Node*, priv::StringHash> m_nodesByText; // First root node with each text
 
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
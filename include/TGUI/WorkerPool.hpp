@@ -0,0 +1,125 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WORKER_POOL_HPP
+#define TGUI_WORKER_POOL_HPP
+
+#include <TGUI/Global.hpp>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Fixed amount of threads that execute jobs in the background
+        ///
+        /// Jobs are started in the order in which they were posted, but several jobs can be running at the same time.
+        /// Results that have to be used on the gui thread can be posted to a CommandQueue by the job.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API WorkerPool
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor that starts the threads
+            ///
+            /// @param threadCount  Amount of threads, or 0 to use one thread less than the amount of hardware threads
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit WorkerPool(unsigned int threadCount = 0);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Destructor
+            ///
+            /// Jobs that didn't start yet are destroyed without being called, the destructor waits for running jobs to finish.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~WorkerPool();
+
+
+            // The pool cannot be copied
+            WorkerPool(const WorkerPool&) = delete;
+            WorkerPool& operator=(const WorkerPool&) = delete;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds a job that will be executed by one of the threads
+            ///
+            /// @param job  Function to call on a worker thread
+            ///
+            /// This function is thread-safe.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void post(std::function<void()> job);
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Blocks until all jobs that were posted have finished
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void waitUntilIdle();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the amount of threads in the pool
+            ///
+            /// @return Amount of worker threads
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            std::size_t getThreadCount() const;
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            // Function executed by each of the threads
+            void run();
+
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        private:
+
+            std::vector<std::thread> m_threads;
+            std::deque<std::function<void()>> m_jobs;
+            std::size_t m_runningJobs = 0;
+            bool m_stopping = false;
+
+            std::mutex m_mutex;
+            std::condition_variable m_jobAvailable;
+            std::condition_variable m_idle;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WORKER_POOL_HPP
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +39,9 @@ namespace tgui
         m_target {target},
         m_oldView{target.getView()}
     {
+        // Geometry that was batched before this point has to be drawn with the old view
+        DrawBatch::flush(target);
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
@@ -97,6 +101,7 @@ namespace tgui
 
     Clipping::~Clipping()
     {
+        DrawBatch::flush(m_target);
         m_target.setView(m_oldView);
     }
 
@@ -108,6 +113,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::View& Clipping::getGuiView()
+    {
+        return m_originalView;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
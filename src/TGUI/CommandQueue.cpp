@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/CommandQueue.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::CommandQueue() :
+        m_head{new Node},
+        m_tail{m_head.load()}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::~CommandQueue()
+    {
+        while (m_tail)
+        {
+            Node* next = m_tail->next.load(std::memory_order_acquire);
+            delete m_tail;
+            m_tail = next;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(std::function<void()> command)
+    {
+        Node* node = new Node;
+        node->command = std::move(command);
+
+        // The counter is increased before the node becomes visible, so that it never lags behind the executed commands
+        const std::uint64_t posted = m_postedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        // Make the node the new head and then link the previous head to it. Until the link is made, the consumer will just
+        // see the queue as ending at the previous head and pick up the new node during its next execution.
+        Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+
+        const std::uint64_t executed = m_executedCount.load(std::memory_order_relaxed);
+        const std::uint64_t pending = (posted > executed) ? (posted - executed) : 0;
+
+        std::uint64_t peak = m_peakPendingCount.load(std::memory_order_relaxed);
+        while ((pending > peak) && !m_peakPendingCount.compare_exchange_weak(peak, pending, std::memory_order_relaxed))
+            ;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::execute(std::size_t maxCommands)
+    {
+        // Only the commands that are already in the queue are executed, so that a command that posts itself again can't
+        // cause an infinite loop
+        std::size_t commandsToExecute = getPendingCount();
+        if ((maxCommands > 0) && (commandsToExecute > maxCommands))
+        {
+            commandsToExecute = maxCommands;
+            m_throttledCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::size_t executed = 0;
+        while (executed < commandsToExecute)
+        {
+            Node* next = m_tail->next.load(std::memory_order_acquire);
+            if (!next)
+                break;
+
+            delete m_tail;
+            m_tail = next;
+
+            // The node stays in the queue as the new tail, so its command has to be taken out of it
+            const std::function<void()> command = std::move(next->command);
+            next->command = nullptr;
+
+            ++executed;
+            m_executedCount.fetch_add(1, std::memory_order_relaxed);
+            command();
+        }
+
+        return executed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::getPendingCount() const
+    {
+        const std::uint64_t executed = m_executedCount.load(std::memory_order_relaxed);
+        const std::uint64_t posted = m_postedCount.load(std::memory_order_relaxed);
+        return (posted > executed) ? static_cast<std::size_t>(posted - executed) : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Statistics CommandQueue::getStatistics() const
+    {
+        Statistics statistics;
+        statistics.executedCommands = m_executedCount.load(std::memory_order_relaxed);
+        statistics.postedCommands = m_postedCount.load(std::memory_order_relaxed);
+        statistics.pendingCommands = getPendingCount();
+        statistics.peakPendingCommands = m_peakPendingCount.load(std::memory_order_relaxed);
+        statistics.throttledExecutions = m_throttledCount.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,16 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/MappedFile.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +63,82 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        FloatRect getChildWidgetArea(const Widget& widget)
+        {
+            const Vector2f position = widget.getPosition() + widget.getWidgetOffset();
+            const Vector2f size = widget.getFullSize();
+            return {position.x, position.y, size.x, size.y};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Area in which mouseOnWidget can return true, e.g. a resizable child window also accepts clicks just outside its borders
+        FloatRect getChildWidgetMouseArea(const Widget& widget)
+        {
+            const FloatRect area = getChildWidgetArea(widget);
+            const Outline margin = widget.getMouseAreaMargin();
+            return {area.left - margin.getLeft(), area.top - margin.getTop(),
+                    area.width + margin.getLeft() + margin.getRight(), area.height + margin.getTop() + margin.getBottom()};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Unlike sf::Rect::intersects, this also returns true when the rectangles only touch or when one of them is empty
+        bool areasOverlap(const FloatRect& area1, const FloatRect& area2)
+        {
+            return (area1.left <= area2.left + area2.width) && (area2.left <= area1.left + area1.width)
+                && (area1.top <= area2.top + area2.height) && (area2.top <= area1.top + area1.height);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the widget to the name index. When recursive is true, the widgets inside it are added as well.
+        void insertInWidgetNameIndex(priv::WidgetNameIndex& index, Widget* widget, const sf::String& name, bool recursive)
+        {
+            // Unnamed widgets aren't indexed, searching for an empty name is handled by looping over the widgets
+            if (!name.isEmpty())
+                index[name].push_back(widget);
+
+            if (recursive && widget->isContainer())
+            {
+                const auto& widgets = static_cast<Container*>(widget)->getWidgets();
+                const auto& widgetNames = static_cast<Container*>(widget)->getWidgetNames();
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                    insertInWidgetNameIndex(index, widgets[i].get(), widgetNames[i], true);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the widget from the name index. When recursive is true, the widgets inside it are removed as well.
+        void eraseFromWidgetNameIndex(priv::WidgetNameIndex& index, Widget* widget, const sf::String& name, bool recursive)
+        {
+            if (!name.isEmpty())
+            {
+                const auto it = index.find(name);
+                if (it != index.end())
+                {
+                    auto& widgets = it->second;
+                    const auto widgetIt = std::find(widgets.begin(), widgets.end(), widget);
+                    if (widgetIt != widgets.end())
+                        widgets.erase(widgetIt);
+
+                    if (widgets.empty())
+                        index.erase(it);
+                }
+            }
+
+            if (recursive && widget->isContainer())
+            {
+                const auto& widgets = static_cast<Container*>(widget)->getWidgets();
+                const auto& widgetNames = static_cast<Container*>(widget)->getWidgetNames();
+                for (std::size_t i = 0; i < widgets.size(); ++i)
+                    eraseFromWidgetNameIndex(index, widgets[i].get(), widgetNames[i], true);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         std::unique_ptr<DataIO::Node> saveRenderer(RendererData* renderer, const std::string& name)
         {
             auto node = std::make_unique<DataIO::Node>();
@@ -66,8 +147,8 @@ namespace tgui
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    auto rendererRootNode = DataIO::parse(ss);
+                    const std::string str = ObjectConverter{pair.second}.getString();
+                    auto rendererRootNode = DataIO::parse(str.data(), str.size());
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
@@ -108,8 +189,12 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget              {other},
+        m_renderCacheEnabled{other.m_renderCacheEnabled}
     {
+        if (other.m_spatialIndex)
+            m_spatialIndex = std::make_unique<priv::SpatialIndex>(other.m_spatialIndex->getCellSize());
+
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
@@ -121,14 +206,19 @@ namespace tgui
         Widget                {std::move(other)},
         m_widgets             {std::move(other.m_widgets)},
         m_widgetNames         {std::move(other.m_widgetNames)},
+        m_widgetNameIndex     {std::move(other.m_widgetNameIndex)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_renderCacheEnabled  {std::move(other.m_renderCacheEnabled)},
+        m_spatialIndex        {std::move(other.m_spatialIndex)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_widgetNames = {};
+        other.m_widgetNameIndex = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -153,10 +243,17 @@ namespace tgui
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = nullptr;
+            m_renderCacheEnabled = right.m_renderCacheEnabled;
+            m_renderCache = nullptr;
 
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            if (right.m_spatialIndex)
+                m_spatialIndex = std::make_unique<priv::SpatialIndex>(right.m_spatialIndex->getCellSize());
+            else
+                m_spatialIndex = nullptr;
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
@@ -178,14 +275,21 @@ namespace tgui
             Widget::operator=(std::move(right));
             m_widgets              = std::move(right.m_widgets);
             m_widgetNames          = std::move(right.m_widgetNames);
+            m_widgetNameIndex      = std::move(right.m_widgetNameIndex);
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_renderCacheEnabled   = std::move(right.m_renderCacheEnabled);
+            m_renderCache          = nullptr;
+            m_renderCacheDirty     = true;
+            m_spatialIndex         = std::move(right.m_spatialIndex);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_widgetNames = {};
+            right.m_widgetNameIndex = {};
         }
 
         return *this;
@@ -222,28 +326,45 @@ namespace tgui
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
 
+        insertInWidgetNameIndex(m_widgetNameIndex, widgetPtr.get(), widgetName, false);
+        if (auto* globalWidgetIndex = findGlobalWidgetIndex())
+            insertInWidgetNameIndex(*globalWidgetIndex, widgetPtr.get(), widgetName, true);
+
+        if (m_spatialIndex)
+            m_spatialIndex->insert(widgetPtr.get(), getChildWidgetMouseArea(*widgetPtr), widgetPtr->m_unboundedArea);
+
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        // When the name is unique then the index of all widgets immediately tells which widget is needed
+        if (m_globalWidgetIndex && !widgetName.isEmpty())
         {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
+            const auto it = m_globalWidgetIndex->find(widgetName);
+            if (it == m_globalWidgetIndex->end())
+                return nullptr;
+            else if (it->second.size() == 1)
+                return it->second.front()->shared_from_this();
         }
 
+        Widget::Ptr widget = getDirectChild(widgetName);
+        if (widget != nullptr)
+            return widget;
+
         for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
         {
             if (m_widgets[i]->isContainer())
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
+                widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
                 if (widget != nullptr)
                     return widget;
             }
@@ -254,6 +375,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Container::getByPath(const sf::String& path) const
+    {
+        const Container* container = this;
+        std::size_t start = 0;
+        while (true)
+        {
+            const std::size_t separator = path.find(".", start);
+            if (separator == sf::String::InvalidPos)
+                return container->getDirectChild(path.substring(start));
+
+            const Widget::Ptr widget = container->getDirectChild(path.substring(start, separator - start));
+            if (!widget || !widget->isContainer())
+                return nullptr;
+
+            container = static_cast<Container*>(widget.get());
+            start = separator + 1;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -274,10 +416,21 @@ namespace tgui
                     widget->setFocused(false);
                 }
 
+                if (widget == m_widgetWithMouseDown)
+                    m_widgetWithMouseDown = nullptr;
+
+                if (m_spatialIndex)
+                    m_spatialIndex->remove(widget.get());
+
+                eraseFromWidgetNameIndex(m_widgetNameIndex, widget.get(), m_widgetNames[i], false);
+                if (auto* globalWidgetIndex = findGlobalWidgetIndex())
+                    eraseFromWidgetNameIndex(*globalWidgetIndex, widget.get(), m_widgetNames[i], true);
+
                 // Remove the widget
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                invalidateRenderCache();
                 return true;
             }
         }
@@ -289,14 +442,32 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
+        if (auto* globalWidgetIndex = findGlobalWidgetIndex())
+        {
+            if (globalWidgetIndex == m_globalWidgetIndex.get())
+                globalWidgetIndex->clear();
+            else
+            {
+                for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                    eraseFromWidgetNameIndex(*globalWidgetIndex, m_widgets[i].get(), m_widgetNames[i], true);
+            }
+        }
+
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
         m_widgets.clear();
         m_widgetNames.clear();
+        m_widgetNameIndex.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+        m_widgetWithMouseDown = nullptr;
+
+        if (m_spatialIndex)
+            m_spatialIndex->clear();
+
+        invalidateRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +478,14 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                eraseFromWidgetNameIndex(m_widgetNameIndex, widget.get(), m_widgetNames[i], false);
+                insertInWidgetNameIndex(m_widgetNameIndex, widget.get(), name, false);
+                if (auto* globalWidgetIndex = findGlobalWidgetIndex())
+                {
+                    eraseFromWidgetNameIndex(*globalWidgetIndex, widget.get(), m_widgetNames[i], false);
+                    insertInWidgetNameIndex(*globalWidgetIndex, widget.get(), name, false);
+                }
+
                 m_widgetNames[i] = name;
                 return true;
             }
@@ -351,35 +530,72 @@ namespace tgui
 
     void Container::loadWidgetsFromFile(const std::string& filename)
     {
-        std::ifstream in{filename};
-        if (!in.is_open())
+        priv::MappedFile file;
+        if (!file.open(filename))
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream);
+        if (DataIO::isBinary(file.getData(), file.getSize()))
+            loadWidgetsFromNodeTree(DataIO::parseBinary(file.getData(), file.getSize()));
+        else
+            loadWidgetsFromNodeTree(DataIO::parse(file.getData(), file.getSize()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::saveWidgetsToFile(const std::string& filename)
     {
-        std::stringstream stream;
-        saveWidgetsToStream(stream);
-
         std::ofstream out{filename};
         if (!out.is_open())
             throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
 
-        out << stream.rdbuf();
+        saveWidgetsToStream(out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        const auto rootNode = saveWidgetsToNodeTree();
+
+        std::ofstream out{filename, std::ios::binary};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+
+        DataIO::emitBinary(rootNode, out);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::loadWidgetsFromStream(std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    {
+        loadWidgetsFromStream(stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToStream(std::ostream& stream) const
+    {
+        SavingRenderersMap renderersMap;
+        DataIO::StreamWriter writer{stream};
+        for (const auto& rendererNode : saveSharedRenderers(renderersMap))
+            writer.writeSection(*rendererNode);
+
+        // Each widget is written as soon as it is saved, so that only the nodes of a single widget exist at the same time
+        for (const auto& child : getWidgets())
+            writer.writeSection(*child->save(renderersMap));
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode)
+    {
         removeAllWidgets(); // The existing widgets will be replaced by the ones that will be loaded
 
         if (rootNode->propertyValuePairs.size() != 0)
@@ -417,22 +633,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream)
+    std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree() const
     {
-        loadWidgetsFromStream(stream);
+        SavingRenderersMap renderersMap;
+        auto node = std::make_unique<DataIO::Node>();
+        node->children = saveSharedRenderers(renderersMap);
+
+        for (const auto& child : getWidgets())
+            node->children.emplace_back(child->save(renderersMap));
+
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::saveWidgetsToStream(std::stringstream& stream) const
+    std::vector<std::unique_ptr<DataIO::Node>> Container::saveSharedRenderers(SavingRenderersMap& renderersMap) const
     {
-        auto node = std::make_unique<DataIO::Node>();
-
         std::map<RendererData*, std::vector<const Widget*>> renderers;
         getAllRenderers(renderers, this);
 
         unsigned int id = 0;
-        SavingRenderersMap renderersMap;
+        std::vector<std::unique_ptr<DataIO::Node>> sharedRendererNodes;
         for (const auto& renderer : renderers)
         {
             // The renderer can remain inside the widget if it is not shared, so provide the node to be included inside the widget
@@ -445,15 +666,12 @@ namespace tgui
             // When the widget is shared, only provide the id instead of the node itself
             ++id;
             const std::string idStr = to_string(id);
-            node->children.push_back(saveRenderer(renderer.first, "Renderer." + idStr));
+            sharedRendererNodes.push_back(saveRenderer(renderer.first, "Renderer." + idStr));
             for (const auto& child : renderer.second)
                 renderersMap[child] = std::make_pair(nullptr, idStr); // Did not compile with VS2015 Update 2 when using braces
         }
 
-        for (const auto& child : getWidgets())
-            node->children.emplace_back(child->save(renderersMap));
-
-        DataIO::emit(node, stream);
+        return sharedRendererNodes;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +691,11 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+
+            if (m_spatialIndex)
+                m_spatialIndex->moveToFront(widget.get());
+
+            invalidateRenderCache();
             break;
         }
     }
@@ -496,12 +719,95 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+
+            if (m_spatialIndex)
+                m_spatialIndex->moveToBack(widget.get());
+
+            invalidateRenderCache();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::setWidgetIndex(const Widget::Ptr& widget, std::size_t index)
+    {
+        if (index >= m_widgets.size())
+            return false;
+
+        const auto it = std::find(m_widgets.begin(), m_widgets.end(), widget);
+        if (it == m_widgets.end())
+            return false;
+
+        const std::size_t oldIndex = static_cast<std::size_t>(it - m_widgets.begin());
+        if (oldIndex == index)
+            return true;
+
+        const sf::String name = m_widgetNames[oldIndex];
+        m_widgets.erase(m_widgets.begin() + oldIndex);
+        m_widgetNames.erase(m_widgetNames.begin() + oldIndex);
+        m_widgets.insert(m_widgets.begin() + index, widget);
+        m_widgetNames.insert(m_widgetNames.begin() + index, name);
+
+        if (m_spatialIndex)
+            m_spatialIndex->setZOrder(m_widgets);
+
+        invalidateRenderCache();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_renderCacheEnabled = enabled;
+        m_renderCacheDirty = true;
+
+        if (!enabled)
+            m_renderCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexEnabled(bool enabled, float cellSize)
+    {
+        if (!enabled)
+        {
+            m_spatialIndex = nullptr;
+            return;
+        }
+
+        m_spatialIndex = std::make_unique<priv::SpatialIndex>(cellSize);
+        for (const auto& widget : m_widgets)
+            m_spatialIndex->insert(widget.get(), getChildWidgetMouseArea(*widget), widget->m_unboundedArea);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateRenderCache()
+    {
+        m_renderCacheDirty = true;
+
+        // The cached image of our parent contains this container, so it becomes outdated as well
+        invalidateParentRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -612,6 +918,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetBoundsChanged(Widget* child)
+    {
+        if (m_spatialIndex)
+            m_spatialIndex->update(child, getChildWidgetMouseArea(*child), child->m_unboundedArea);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         sf::Event event;
@@ -809,12 +1123,40 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
+        // Widgets that aren't updated while offscreen only have to be compared with the visible area when the spatial index
+        // found them near that area. The list is sorted on address and only created when such a widget is encountered.
+        std::vector<Widget*> widgetsNearVisibleArea;
+        bool widgetsNearVisibleAreaQueried = false;
+
         // Loop through all widgets
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
+            const auto& widget = m_widgets[i];
+            if (!widget->isVisible())
+                continue;
+
+            // Some widgets don't need to be updated while they aren't being shown
+            if (!widget->m_offscreenUpdates && m_visibleAreaKnown && !widget->m_unboundedArea)
+            {
+                if (m_spatialIndex)
+                {
+                    if (!widgetsNearVisibleAreaQueried)
+                    {
+                        widgetsNearVisibleArea = m_spatialIndex->query(m_visibleArea);
+                        std::sort(widgetsNearVisibleArea.begin(), widgetsNearVisibleArea.end());
+                        widgetsNearVisibleAreaQueried = true;
+                    }
+
+                    if (!std::binary_search(widgetsNearVisibleArea.begin(), widgetsNearVisibleArea.end(), widget.get()))
+                        continue;
+                }
+
+                if (!areasOverlap(getChildWidgetArea(*widget), m_visibleArea))
+                    continue;
+            }
+
             // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            widget->update(elapsedTime);
         }
 
         m_animationTimeElapsed = {};
@@ -833,19 +1175,13 @@ namespace tgui
             else
                 mousePos = {static_cast<float>(event.touch.x), static_cast<float>(event.touch.y)};
 
-            // Loop through all widgets
-            for (auto& widget : m_widgets)
+            // Check if the mouse went down on a widget and is still down.
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            if (m_widgetWithMouseDown && m_widgetWithMouseDown->m_mouseDown
+             && (m_widgetWithMouseDown->m_draggableWidget || m_widgetWithMouseDown->isContainer()))
             {
-                // Check if the mouse went down on the widget
-                if (widget->m_mouseDown)
-                {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if (widget->m_draggableWidget || widget->isContainer())
-                    {
-                        widget->mouseMoved(mousePos);
-                        return true;
-                    }
-                }
+                m_widgetWithMouseDown->mouseMoved(mousePos);
+                return true;
             }
 
             // Check if the mouse is on top of a widget
@@ -879,6 +1215,7 @@ namespace tgui
 
                 // Focus the widget unless it is a container, in which case it will get focused when the event is handled by the bottom widget
                 m_focusedWidget = widget;
+                m_widgetWithMouseDown = widget;
                 if (!widget->isContainer())
                     widget->setFocused(true);
 
@@ -998,19 +1335,36 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            // The spatial index returns the widgets that might be below the mouse, sorted from top to bottom
+            for (Widget* candidate : m_spatialIndex->query(mousePos))
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if (candidate->isVisible() && candidate->mouseOnWidget(mousePos))
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if (candidate->isEnabled())
+                        widget = candidate->shared_from_this();
 
                     break;
                 }
             }
         }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if ((*it)->isVisible())
+                {
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
+
+                        break;
+                    }
+                }
+            }
+        }
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
@@ -1024,12 +1378,120 @@ namespace tgui
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Draw all widgets when they are visible
-        for (const auto& widget : m_widgets)
+        if (!m_visibleAreaKnown)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            // Draw all widgets when they are visible
+            for (const auto& widget : m_widgets)
+            {
+                if (widget->isVisible())
+                    widget->draw(*target, states);
+            }
+            return;
+        }
+
+        // Don't draw widgets that would end up completely outside the clipping area.
+        // The spatial index can skip most of those widgets without looking at them.
+        if (m_spatialIndex)
+        {
+            for (Widget* widget : m_spatialIndex->query(m_visibleArea))
+            {
+                if (widget->isVisible() && (widget->m_unboundedArea || areasOverlap(getChildWidgetArea(*widget), m_visibleArea)))
+                    widget->draw(*target, states);
+            }
         }
+        else
+        {
+            for (const auto& widget : m_widgets)
+            {
+                if (widget->isVisible() && (widget->m_unboundedArea || areasOverlap(getChildWidgetArea(*widget), m_visibleArea)))
+                    widget->draw(*target, states);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) const
+    {
+        m_visibleArea = {topLeft.x, topLeft.y, size.x, size.y};
+        m_visibleAreaKnown = true;
+
+        if (!m_renderCacheEnabled)
+        {
+            drawWidgetContainer(&target, states);
+            return;
+        }
+
+        if ((size.x <= 0) || (size.y <= 0))
+            return;
+
+        // The texture gets the size that the area has on the screen, so that the widgets aren't drawn blurry when scaled
+        const sf::Vector2i pixelTopLeft = target.mapCoordsToPixel(states.transform.transformPoint(topLeft));
+        const sf::Vector2i pixelBottomRight = target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size));
+        const sf::Vector2u textureSize{static_cast<unsigned int>(std::abs(pixelBottomRight.x - pixelTopLeft.x)),
+                                       static_cast<unsigned int>(std::abs(pixelBottomRight.y - pixelTopLeft.y))};
+        if ((textureSize.x == 0) || (textureSize.y == 0))
+            return;
+
+        if (!m_renderCache || (m_renderCache->getSize() != textureSize))
+        {
+            if (!m_renderCache)
+                m_renderCache = std::make_unique<sf::RenderTexture>();
+
+            // Fall back to drawing the widgets directly if no texture of the requested size can be created
+            if (!m_renderCache->create(textureSize.x, textureSize.y))
+            {
+                m_renderCache = nullptr;
+                drawWidgetContainer(&target, states);
+                return;
+            }
+
+            m_renderCacheDirty = true;
+        }
+
+        if ((topLeft != m_renderCacheTopLeft) || (size != m_renderCacheSize))
+        {
+            m_renderCacheTopLeft = topLeft;
+            m_renderCacheSize = size;
+            m_renderCacheDirty = true;
+        }
+
+        if (m_renderCacheDirty)
+        {
+            m_renderCacheDirty = false;
+
+            // The view maps the area in gui coordinates on the whole texture.
+            // Clipping inside the child widgets has to be calculated relative to this view instead of the gui view.
+            const sf::View cacheView{{0, 0, size.x, size.y}};
+            const sf::View oldGuiView = Clipping::getGuiView();
+            Clipping::setGuiView(cacheView);
+
+            sf::RenderStates cacheStates;
+            cacheStates.transform.translate(-topLeft);
+
+            m_renderCache->setView(cacheView);
+            m_renderCache->clear(sf::Color::Transparent);
+            drawWidgetContainer(m_renderCache.get(), cacheStates);
+            m_renderCache->display();
+
+            Clipping::setGuiView(oldGuiView);
+        }
+
+        // Since the widgets were blended on a transparent texture, its colors are already multiplied with their alpha
+        sf::RenderStates textureStates = states;
+        textureStates.transform.translate(topLeft);
+        textureStates.texture = &m_renderCache->getTexture();
+        textureStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+
+        const float textureWidth = static_cast<float>(textureSize.x);
+        const float textureHeight = static_cast<float>(textureSize.y);
+        const sf::Vertex vertices[] = {
+            {{0, 0}, {0, 0}},
+            {{size.x, 0}, {textureWidth, 0}},
+            {{0, size.y}, {0, textureHeight}},
+            {{size.x, size.y}, {textureWidth, textureHeight}}
+        };
+        DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, textureStates);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1084,6 +1546,67 @@ namespace tgui
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::getDirectChild(const sf::String& widgetName) const
+    {
+        if (widgetName.isEmpty())
+        {
+            for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+            {
+                if (m_widgetNames[i].isEmpty())
+                    return m_widgets[i];
+            }
+
+            return nullptr;
+        }
+
+        const auto it = m_widgetNameIndex.find(widgetName);
+        if (it == m_widgetNameIndex.end())
+            return nullptr;
+
+        if (it->second.size() == 1)
+            return it->second.front()->shared_from_this();
+
+        // When multiple widgets have the same name, return the one that was added first
+        for (const auto& widget : m_widgets)
+        {
+            if (std::find(it->second.begin(), it->second.end(), widget.get()) != it->second.end())
+                return widget;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setGlobalWidgetIndexEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            m_globalWidgetIndex = nullptr;
+            return;
+        }
+
+        if (m_globalWidgetIndex)
+            return;
+
+        m_globalWidgetIndex = std::make_unique<priv::WidgetNameIndex>();
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            insertInWidgetNameIndex(*m_globalWidgetIndex, m_widgets[i].get(), m_widgetNames[i], true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::WidgetNameIndex* Container::findGlobalWidgetIndex() const
+    {
+        const Container* container = this;
+        while (container->m_parent)
+            container = container->m_parent;
+
+        return container->m_globalWidgetIndex.get();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/CustomWidgetForBindings.hpp>
+#include <TGUI/DrawBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -31,6 +32,14 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    CustomWidgetForBindings::CustomWidgetForBindings()
+    {
+        // The draw and mouseOnWidget functions are implemented in the bindings and could use any area
+        m_unboundedArea = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     CustomWidgetForBindings::Ptr CustomWidgetForBindings::create()
     {
         return std::make_shared<CustomWidgetForBindings>();
@@ -110,6 +119,9 @@ namespace tgui
     {
         Widget::update(elapsedTime);
         implUpdateFunction(elapsedTime);
+
+        // There is no way to know whether the update function changed how the widget looks
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,6 +238,8 @@ namespace tgui
 
     void CustomWidgetForBindings::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
+        // The draw function of the binding draws directly on the target, so everything before it has to be drawn first
+        DrawBatch::flush(target);
         implDrawFunction(target, states);
     }
 
@@ -0,0 +1,236 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DrawBatch.hpp>
+
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    DrawBatch* DrawBatch::m_activeBatch = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Font textures contain a white square of 2x2 pixels in the top left corner, the center of which is used by
+        // sf::Text to draw underlines. Untextured geometry can use these texture coordinates to be drawn with the font texture.
+        const sf::Vector2f whiteFontPixel{1, 1};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::setBatchingEnabled(bool enabled)
+    {
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatch::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DrawBatch::getDrawCallCount() const
+    {
+        return m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::begin(sf::RenderTarget& target)
+    {
+        assert(m_target == nullptr);
+
+        m_target = &target;
+        m_drawCallCount = 0;
+
+        m_previousBatch = m_activeBatch;
+        m_activeBatch = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::end()
+    {
+        assert(m_activeBatch == this);
+
+        flushVertices();
+
+        m_activeBatch = m_previousBatch;
+        m_previousBatch = nullptr;
+        m_target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                         const sf::RenderStates& states, bool fontTexture)
+    {
+        DrawBatch* batch = getActiveBatch(target);
+        if (!batch)
+        {
+            target.draw(vertices, vertexCount, type, states);
+            return;
+        }
+
+        // Only triangles drawn with the default blend mode and without a shader can be merged
+        if (batch->m_batchingEnabled && (states.shader == nullptr) && (states.blendMode == sf::BlendAlpha)
+         && ((type == sf::PrimitiveType::Triangles) || (type == sf::PrimitiveType::TrianglesStrip) || (type == sf::PrimitiveType::TrianglesFan)))
+        {
+            batch->append(vertices, vertexCount, type, states, fontTexture);
+        }
+        else
+        {
+            batch->flushVertices();
+            batch->m_drawCallCount++;
+            target.draw(vertices, vertexCount, type, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        DrawBatch* batch = getActiveBatch(target);
+        if (batch)
+        {
+            batch->flushVertices();
+            batch->m_drawCallCount++;
+        }
+
+        target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::flush(sf::RenderTarget& target)
+    {
+        DrawBatch* batch = getActiveBatch(target);
+        if (batch)
+            batch->flushVertices();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatch::isBatching(const sf::RenderTarget& target)
+    {
+        const DrawBatch* batch = getActiveBatch(target);
+        return batch && batch->m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch* DrawBatch::getActiveBatch(const sf::RenderTarget& target)
+    {
+        if (m_activeBatch && (m_activeBatch->m_target == &target))
+            return m_activeBatch;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::append(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states, bool fontTexture)
+    {
+        if (vertexCount < 3)
+            return;
+
+        // Find out whether the new triangles can be drawn in the same draw call as the pending ones.
+        // Untextured triangles can be merged with triangles that use a font texture by using the white pixel in that texture.
+        bool useWhitePixel = false;
+        if (!m_vertices.empty() && (states.texture != m_texture))
+        {
+            if (!states.texture && m_fontTexture)
+                useWhitePixel = true;
+            else if (!m_texture && fontTexture)
+            {
+                for (auto& vertex : m_vertices)
+                    vertex.texCoords = whiteFontPixel;
+            }
+            else
+                flushVertices();
+        }
+
+        if (m_vertices.empty() || (!m_texture && states.texture))
+        {
+            m_texture = states.texture;
+            m_fontTexture = fontTexture;
+        }
+
+        const auto addVertex = [&](const sf::Vertex& vertex){
+            m_vertices.emplace_back(states.transform.transformPoint(vertex.position), vertex.color, useWhitePixel ? whiteFontPixel : vertex.texCoords);
+        };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                addVertex(vertices[i]);
+        }
+        else if (type == sf::PrimitiveType::TrianglesStrip)
+        {
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                addVertex(vertices[i-2]);
+                addVertex(vertices[i-1]);
+                addVertex(vertices[i]);
+            }
+        }
+        else // TrianglesFan
+        {
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                addVertex(vertices[0]);
+                addVertex(vertices[i-1]);
+                addVertex(vertices[i]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::flushVertices()
+    {
+        if (m_vertices.empty())
+            return;
+
+        m_target->draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, sf::RenderStates{m_texture});
+        m_drawCallCount++;
+
+        m_vertices.clear();
+        m_texture = nullptr;
+        m_fontTexture = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,13 +25,34 @@
 
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Global.hpp>
 
 #include <cassert>
+#include <chrono>
+#include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    std::map<sf::String, Font::FontCacheEntry> Font::m_fontCache;
+    std::size_t Font::m_fontCacheHitCount = 0;
+    std::size_t Font::m_fontCacheMissCount = 0;
+    sf::Time Font::m_fontCacheLoadTime;
+
+    namespace
+    {
+        std::size_t getFontFileSize(const std::string& filename)
+        {
+            std::ifstream file{filename, std::ios::binary | std::ios::ate};
+            if (!file)
+                return 0;
+
+            const auto size = file.tellg();
+            return (size > 0) ? static_cast<std::size_t>(size) : 0;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -227,6 +248,119 @@ namespace tgui
             return 0;
     }
 
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> Font::loadFromCache(const sf::String& filename)
+    {
+        if (filename.isEmpty())
+            return nullptr;
+
+        // Insert the resource path into the filename unless the filename is an absolute path
+        sf::String fullFilename;
+#ifdef SFML_SYSTEM_WINDOWS
+        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
+#else
+        if (filename[0] != '/')
+#endif
+            fullFilename = getResourcePath() + filename;
+        else
+            fullFilename = filename;
+
+        const auto it = m_fontCache.find(fullFilename);
+        if (it != m_fontCache.end())
+        {
+            if (auto font = it->second.font.lock())
+            {
+                ++m_fontCacheHitCount;
+                return font;
+            }
+
+            m_fontCache.erase(it);
+        }
+
+        ++m_fontCacheMissCount;
+        removeExpiredFontsFromCache();
+
+        const auto startTime = std::chrono::steady_clock::now();
+        auto font = std::make_shared<sf::Font>();
+        const bool loaded = font->loadFromFile(fullFilename);
+        m_fontCacheLoadTime += sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now() - startTime).count());
+
+        // A font that failed to load is still returned (like before the cache existed), but it isn't shared so that
+        // the next attempt will try loading the file again.
+        if (loaded)
+            m_fontCache[fullFilename] = {font, getFontFileSize(fullFilename)};
+
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getCachedFontCount()
+    {
+        removeExpiredFontsFromCache();
+        return m_fontCache.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getFontCacheMemoryUsage()
+    {
+        removeExpiredFontsFromCache();
+
+        std::size_t memoryUsage = 0;
+        for (const auto& pair : m_fontCache)
+            memoryUsage += pair.second.fileSize;
+
+        return memoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getFontCacheHitCount()
+    {
+        return m_fontCacheHitCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getFontCacheMissCount()
+    {
+        return m_fontCacheMissCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Font::getFontCacheLoadTime()
+    {
+        return m_fontCacheLoadTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::clearFontCache()
+    {
+        m_fontCache.clear();
+        m_fontCacheHitCount = 0;
+        m_fontCacheMissCount = 0;
+        m_fontCacheLoadTime = sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::removeExpiredFontsFromCache()
+    {
+        for (auto it = m_fontCache.begin(); it != m_fontCache.end();)
+        {
+            if (it->second.font.expired())
+                it = m_fontCache.erase(it);
+            else
+                ++it;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
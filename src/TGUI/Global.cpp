@@ -215,6 +215,21 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t priv::StringHash::operator()(const sf::String& str) const
+    {
+        // FNV-1a hash of the UTF-32 characters
+        std::size_t hash = 2166136261u;
+        for (const sf::Uint32 character : str)
+        {
+            hash ^= static_cast<std::size_t>(character);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
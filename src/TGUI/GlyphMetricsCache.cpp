@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/GlyphMetricsCache.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            struct GlyphMetricsCachesForFont
+            {
+                std::weak_ptr<sf::Font> font;
+                std::map<std::pair<unsigned int, bool>, std::unique_ptr<GlyphMetricsCache>> caches;
+            };
+
+            std::map<const sf::Font*, GlyphMetricsCachesForFont> glyphMetricsCaches;
+
+            const float unknownGlyphMetric = std::numeric_limits<float>::quiet_NaN();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetricsCache::GlyphMetricsCache(sf::Font& font, unsigned int characterSize, bool bold) :
+            m_font              {font},
+            m_characterSize     {characterSize},
+            m_bold              {bold},
+            m_extraVerticalSpace{unknownGlyphMetric}
+        {
+            m_latinAdvances.fill(unknownGlyphMetric);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        GlyphMetricsCache& GlyphMetricsCache::get(const Font& font, unsigned int characterSize, bool bold)
+        {
+            const std::shared_ptr<sf::Font> sfFont = font.getFont();
+            assert(sfFont != nullptr);
+
+            auto it = glyphMetricsCaches.find(sfFont.get());
+
+            // If the font that we cached was destroyed then a new font was created at the same address
+            if ((it != glyphMetricsCaches.end()) && it->second.font.expired())
+            {
+                glyphMetricsCaches.erase(it);
+                it = glyphMetricsCaches.end();
+            }
+
+            if (it == glyphMetricsCaches.end())
+            {
+                // Remove the caches of all other fonts that no longer exist
+                for (auto fontIt = glyphMetricsCaches.begin(); fontIt != glyphMetricsCaches.end();)
+                {
+                    if (fontIt->second.font.expired())
+                        fontIt = glyphMetricsCaches.erase(fontIt);
+                    else
+                        ++fontIt;
+                }
+
+                it = glyphMetricsCaches.insert({sfFont.get(), GlyphMetricsCachesForFont{sfFont, {}}}).first;
+            }
+
+            auto& cache = it->second.caches[{characterSize, bold}];
+            if (!cache)
+                cache = std::make_unique<GlyphMetricsCache>(*sfFont, characterSize, bold);
+
+            return *cache;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void GlyphMetricsCache::clear()
+        {
+            glyphMetricsCaches.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetricsCache::getLineWidth(const sf::String& text)
+        {
+            float width = 0;
+            std::uint32_t prevChar = 0;
+            for (const std::uint32_t curChar : text)
+            {
+                if (curChar == '\n')
+                    break;
+
+                width = width + getAdvance(curChar) + getKerning(prevChar, curChar);
+                prevChar = curChar;
+            }
+
+            return width;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetricsCache::getExtraVerticalSpace()
+        {
+            if (std::isnan(m_extraVerticalSpace))
+            {
+                // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
+                const sf::Glyph& glyph = m_font.getGlyph('g', m_characterSize, m_bold);
+                const float lineHeight = m_characterSize + glyph.bounds.height + glyph.bounds.top;
+
+                // Calculate the offset of the text, compared to the line spacing that sfml returns
+                m_extraVerticalSpace = lineHeight - m_font.getLineSpacing(m_characterSize);
+            }
+
+            return m_extraVerticalSpace;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetricsCache::loadAdvance(std::uint32_t codePoint)
+        {
+            if (codePoint >= LatinCharacterCount)
+            {
+                const auto it = m_otherAdvances.find(codePoint);
+                if (it != m_otherAdvances.end())
+                    return it->second;
+            }
+
+            float advance;
+            if (codePoint == '\t')
+                advance = static_cast<float>(m_font.getGlyph(' ', m_characterSize, m_bold).advance) * 4;
+            else
+                advance = static_cast<float>(m_font.getGlyph(codePoint, m_characterSize, m_bold).advance);
+
+            if (codePoint < LatinCharacterCount)
+                m_latinAdvances[codePoint] = advance;
+            else
+                m_otherAdvances[codePoint] = advance;
+
+            return advance;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float GlyphMetricsCache::loadKerning(std::uint32_t first, std::uint32_t second)
+        {
+            const float kerning = m_font.getKerning(first, second, m_characterSize);
+            if ((first < LatinCharacterCount) && (second < LatinCharacterCount))
+            {
+                auto& row = m_latinKerning[first];
+                if (!row)
+                {
+                    row = std::make_unique<float[]>(LatinCharacterCount);
+                    std::fill(row.get(), row.get() + LatinCharacterCount, unknownGlyphMetric);
+                }
+
+                row[second] = kerning;
+            }
+
+            return kerning;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/TextureManager.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
@@ -283,19 +284,27 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
-        // Update the time
+        // Update the time, commands from other threads are still executed when the window is unfocused
         if (m_windowFocused)
             updateTime(m_clock.restart());
         else
+        {
             m_clock.restart();
+            processCommands();
+        }
 
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
         Clipping::setGuiView(m_view);
 
+        // Create the textures for images that were loaded or rasterized in the background before they are used
+        TextureManager::processPendingUploads();
+
         // Draw the widgets
+        m_drawBatch.begin(*m_target);
         m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        m_drawBatch.end();
 
         // Restore the old view
         m_target->setView(oldView);
@@ -303,6 +312,62 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setDrawBatchingEnabled(bool enabled)
+    {
+        m_drawBatch.setBatchingEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawBatchingEnabled() const
+    {
+        return m_drawBatch.isBatchingEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Gui::getDrawCallCount() const
+    {
+        return m_drawBatch.getDrawCallCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(std::function<void()> command)
+    {
+        m_commandQueue.post(std::move(command));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setMaxCommandsPerUpdate(std::size_t maxCommands)
+    {
+        m_maxCommandsPerUpdate = maxCommands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Gui::getMaxCommandsPerUpdate() const
+    {
+        return m_maxCommandsPerUpdate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Statistics Gui::getCommandQueueStatistics() const
+    {
+        return m_commandQueue.getStatistics();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::processCommands()
+    {
+        m_commandQueue.execute(m_maxCommandsPerUpdate);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -352,6 +417,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Widget::Ptr Gui::getByPath(const sf::String& path) const
+    {
+        return m_container->getByPath(path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setWidgetIndexEnabled(bool enabled)
+    {
+        m_container->setGlobalWidgetIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isWidgetIndexEnabled() const
+    {
+        return m_container->m_globalWidgetIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Gui::remove(const Widget::Ptr& widget)
     {
         return m_container->remove(widget);
@@ -436,6 +522,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::saveWidgetsToBinaryFile(const std::string& filename)
+    {
+        m_container->saveWidgetsToBinaryFile(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::loadWidgetsFromStream(std::stringstream& stream)
     {
         m_container->loadWidgetsFromStream(stream);
@@ -450,7 +543,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::saveWidgetsToStream(std::stringstream& stream) const
+    void Gui::saveWidgetsToStream(std::ostream& stream) const
     {
         m_container->saveWidgetsToStream(stream);
     }
@@ -459,6 +552,8 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        processCommands();
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
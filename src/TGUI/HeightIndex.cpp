@@ -0,0 +1,251 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/HeightIndex.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        std::size_t HeightIndex::getSize() const
+        {
+            return m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::pushBack(float height)
+        {
+            if (m_firstSlot + m_size == m_heights.size())
+                rebuild();
+
+            addToSlot(m_firstSlot + m_size, height);
+            m_totalHeight += height;
+            ++m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::pushFront(float height)
+        {
+            if (m_firstSlot == 0)
+                rebuild();
+
+            --m_firstSlot;
+            addToSlot(m_firstSlot, height);
+            m_totalHeight += height;
+            ++m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::popBack()
+        {
+            assert(m_size > 0);
+
+            const std::size_t slot = m_firstSlot + m_size - 1;
+            m_totalHeight -= m_heights[slot];
+            addToSlot(slot, -m_heights[slot]);
+            m_heights[slot] = 0;
+
+            // Rounding errors can't accumulate when there are no items left
+            if (--m_size == 0)
+                m_totalHeight = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::popFront()
+        {
+            assert(m_size > 0);
+
+            const std::size_t slot = m_firstSlot;
+            m_totalHeight -= m_heights[slot];
+            addToSlot(slot, -m_heights[slot]);
+            m_heights[slot] = 0;
+            ++m_firstSlot;
+
+            // Rounding errors can't accumulate when there are no items left
+            if (--m_size == 0)
+                m_totalHeight = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::erase(std::size_t index, std::size_t count)
+        {
+            assert(index + count <= m_size);
+
+            if (index == 0)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    popFront();
+            }
+            else if (index + count == m_size)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    popBack();
+            }
+            else // An item in the middle is removed, so all items behind it have to be moved
+            {
+                m_heights.erase(m_heights.begin() + static_cast<std::ptrdiff_t>(m_firstSlot + index),
+                                m_heights.begin() + static_cast<std::ptrdiff_t>(m_firstSlot + index + count));
+                m_heights.insert(m_heights.end(), count, 0);
+                m_size -= count;
+                rebuild();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::assign(const std::vector<float>& heights)
+        {
+            m_heights.assign(heights.begin(), heights.end());
+            m_firstSlot = 0;
+            m_size = heights.size();
+            rebuild();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::clear()
+        {
+            m_heights.clear();
+            m_tree.clear();
+            m_firstSlot = 0;
+            m_size = 0;
+            m_totalHeight = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getHeight(std::size_t index) const
+        {
+            assert(index < m_size);
+            return static_cast<float>(m_heights[m_firstSlot + index]);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getTotalHeight() const
+        {
+            return static_cast<float>(m_totalHeight);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float HeightIndex::getPosition(std::size_t index) const
+        {
+            assert(index <= m_size);
+            return static_cast<float>(getSlotsPrefixSum(m_firstSlot + index) - getSlotsPrefixSum(m_firstSlot));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t HeightIndex::findIndex(float offset) const
+        {
+            if ((offset < 0) || (m_size == 0))
+                return 0;
+
+            // Walk down the tree to find the amount of slots of which the summed height doesn't exceed the offset
+            double remaining = offset + getSlotsPrefixSum(m_firstSlot);
+            std::size_t step = 1;
+            while (step * 2 <= m_heights.size())
+                step *= 2;
+
+            std::size_t slotCount = 0;
+            for (; step > 0; step /= 2)
+            {
+                if ((slotCount + step <= m_heights.size()) && (m_tree[slotCount + step] <= remaining))
+                {
+                    slotCount += step;
+                    remaining -= m_tree[slotCount];
+                }
+            }
+
+            if (slotCount < m_firstSlot)
+                return 0;
+            else
+                return std::min(slotCount - m_firstSlot, m_size);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::rebuild()
+        {
+            // Leave room at both sides so that the tree doesn't need to be rebuilt again until many items have been added
+            const std::size_t freeSlots = (m_size / 2) + 16;
+
+            std::vector<double> heights(freeSlots + m_size + freeSlots, 0);
+            std::copy(m_heights.begin() + static_cast<std::ptrdiff_t>(m_firstSlot),
+                      m_heights.begin() + static_cast<std::ptrdiff_t>(m_firstSlot + m_size),
+                      heights.begin() + static_cast<std::ptrdiff_t>(freeSlots));
+            m_heights = std::move(heights);
+            m_firstSlot = freeSlots;
+
+            // Every node adds its sum to its parent, which builds the tree in linear time
+            m_tree.assign(m_heights.size() + 1, 0);
+            m_totalHeight = 0;
+            for (std::size_t i = 1; i < m_tree.size(); ++i)
+            {
+                m_tree[i] += m_heights[i - 1];
+                m_totalHeight += m_heights[i - 1];
+
+                const std::size_t parent = i + (i & (~i + 1));
+                if (parent < m_tree.size())
+                    m_tree[parent] += m_tree[i];
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void HeightIndex::addToSlot(std::size_t slot, double value)
+        {
+            m_heights[slot] += value;
+            for (std::size_t i = slot + 1; i < m_tree.size(); i += (i & (~i + 1)))
+                m_tree[i] += value;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        double HeightIndex::getSlotsPrefixSum(std::size_t count) const
+        {
+            double sum = 0;
+            for (std::size_t i = count; i > 0; i -= (i & (~i + 1)))
+                sum += m_tree[i];
+
+            return sum;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
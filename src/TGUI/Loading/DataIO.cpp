@@ -27,467 +27,672 @@
 #include <TGUI/Global.hpp>
 #include <TGUI/to_string.hpp>
 
+#include <unordered_map>
+#include <iterator>
+#include <algorithm>
+#include <cstdint>
 #include <cctype>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-#define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
-    for (;;) \
-    { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
-            break; \
-        \
-        if (stream.peek() == '/') \
-        { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
-            else \
-                return "Unexpected '/' found."; \
-            \
-            continue; \
-        } \
-        break; \
-    } \
-    \
-    if (stream.peek() == EOF) \
-    { \
-        if (ReturnErrorOnEOF) \
-            return "Unexpected EOF while parsing."; \
-        else \
-            return ""; \
-    }
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 namespace tgui
 {
     namespace
     {
-        // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        // Parser for the text format of widget files, which reads the characters directly from a contiguous buffer
+        class WidgetFileParser
+        {
+        public:
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            WidgetFileParser(const char* data, std::size_t size) :
+                m_data(data),
+                m_size(size)
+            {
+            }
 
-        std::string readWord(std::stringstream& stream)
-        {
-            std::string word = "";
-            while (stream.peek() != EOF)
+            std::unique_ptr<DataIO::Node> parse()
             {
-                char c = static_cast<char>(stream.peek());
-                if (c == '\r')
+                auto root = std::make_unique<DataIO::Node>();
+                while (peek() != EOF)
                 {
-                    stream.read(&c, 1);
-                    return word;
+                    const std::string error = parseRootSection(root);
+                    if (!error.empty())
+                    {
+                        const auto lineNumber = std::count(m_data, m_data + m_position, '\n') + 1;
+                        throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
+                    }
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+
+                return root;
+            }
+
+        private:
+
+            int peek() const
+            {
+                if (m_position < m_size)
+                    return static_cast<unsigned char>(m_data[m_position]);
+                else
+                    return EOF;
+            }
+
+            char get()
+            {
+                assert(m_position < m_size);
+                return m_data[m_position++];
+            }
+
+            static bool isWhitespace(int c)
+            {
+                return (c != EOF) && ::isspace(c);
+            }
+
+            // Skips whitespace and comments. Returns true when the caller has to return the error that is stored in the
+            // parameter, which is empty when the end of the input was reached and that is allowed at this point.
+            bool skipWhitespaceAndComments(bool errorOnEOF, std::string& error)
+            {
+                for (;;)
                 {
-                    stream.read(&c, 1);
+                    while (isWhitespace(peek()))
+                        ++m_position;
+
+                    if (peek() != '/')
+                        break;
 
-                    if ((c == '/') && (stream.peek() == '/'))
+                    ++m_position;
+                    if (peek() == '/')
+                    {
+                        while ((peek() != EOF) && (get() != '\n'))
+                            ;
+                    }
+                    else if (peek() == '*')
                     {
-                        while (stream.peek() != EOF)
+                        while (peek() != EOF)
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
+                            ++m_position;
+                            if (peek() == '*')
                             {
-                                assert(!word.empty()); // No known case in which you can pass here with an empty word
-                                return word;
+                                ++m_position;
+                                if (peek() == '/')
+                                {
+                                    ++m_position;
+                                    break;
+                                }
                             }
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else
+                    {
+                        error = "Unexpected '/' found.";
+                        return true;
+                    }
+                }
+
+                if (peek() == EOF)
+                {
+                    error = errorOnEOF ? "Unexpected EOF while parsing." : "";
+                    return true;
+                }
+
+                return false;
+            }
+
+            // Reads the characters of a quoted string (the opening quote has already been added to the output)
+            void readQuotedString(std::string& output)
+            {
+                bool backslash = false;
+                while (peek() != EOF)
+                {
+                    const char c = get();
+                    output.push_back(c);
+
+                    if (c == '"' && !backslash)
+                        break;
+
+                    if (c == '\\' && !backslash)
+                        backslash = true;
+                    else
+                        backslash = false;
+                }
+            }
+
+            std::string readWord()
+            {
+                std::string word;
+                while (peek() != EOF)
+                {
+                    const int next = peek();
+                    if (next == '\r')
+                    {
+                        ++m_position;
+                        return word;
+                    }
+                    else if (!isWhitespace(next) && (next != '=') && (next != ';') && (next != '{') && (next != '}'))
                     {
-                        while (stream.peek() != EOF)
+                        const char c = get();
+                        if ((c == '/') && (peek() == '/'))
                         {
-                            stream.read(&c, 1);
-                            if (c == '*')
+                            while (peek() != EOF)
                             {
-                                if (stream.peek() == '/')
+                                if (get() == '\n')
                                 {
-                                    stream.read(&c, 1);
+                                    assert(!word.empty()); // No known case in which you can pass here with an empty word
+                                    return word;
+                                }
+                            }
+                        }
+                        else if ((c == '/') && (peek() == '*'))
+                        {
+                            while (peek() != EOF)
+                            {
+                                if ((get() == '*') && (peek() == '/'))
+                                {
+                                    ++m_position;
                                     break;
                                 }
                             }
                         }
-                    }
-                    else if (c == '"')
-                    {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
+                        else if (c == '"')
                         {
-                            stream.read(&c, 1);
                             word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
+                            readQuotedString(word);
                         }
+                        else
+                            word.push_back(c);
                     }
                     else
-                        word.push_back(c);
+                        return word;
                 }
-                else
-                    return word;
-            }
 
-            return "";
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+                return "";
+            }
 
-        std::string readLine(std::stringstream& stream)
-        {
-            std::string line;
-            bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            // Reads a value into the buffer that is passed to the function, so that its memory can be reused for every value
+            void readLine(std::string& line)
             {
-                char c = static_cast<char>(stream.peek());
-
-                if (c == '/')
+                line.clear();
+                bool whitespaceFound = false;
+                while (peek() != EOF)
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
+                    int c = peek();
+                    if (c == '/')
                     {
-                        while (stream.peek() != EOF)
+                        ++m_position;
+                        if (peek() == '/')
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
+                            while ((peek() != EOF) && (get() != '\n'))
+                                ;
                         }
-                    }
-                    else if (stream.peek() == '*')
-                    {
-                        while (stream.peek() != EOF)
+                        else if (peek() == '*')
                         {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
+                            while (peek() != EOF)
                             {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
+                                ++m_position;
+                                if (peek() == '*')
                                 {
-                                    stream.read(&c, 1);
-                                    break;
+                                    ++m_position;
+                                    if (peek() == '/')
+                                    {
+                                        ++m_position;
+                                        break;
+                                    }
                                 }
                             }
                         }
+                        else // The slash is part of the value
+                        {
+                            whitespaceFound = false;
+                            line.push_back('/');
+                        }
+
                         continue;
                     }
-                    else // The slash is part of the value
-                    {
-                        whitespaceFound = false;
-                        line.push_back(c);
-                    }
-
-                    continue;
-                }
-
-                if (c == '"')
-                {
-                    stream.read(&c, 1);
-                    line.push_back(c);
 
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
+                    if (c == '"')
                     {
-                        stream.read(&c, 1);
-                        line.push_back(c);
+                        line.push_back(get());
+                        readQuotedString(line);
 
-                        if (c == '"' && !backslash)
-                            break;
+                        if (peek() == EOF)
+                        {
+                            line.clear();
+                            return;
+                        }
 
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
+                        c = peek();
                     }
 
-                    if (stream.peek() == EOF)
-                        return "";
-
-                    c = static_cast<char>(stream.peek());
-                }
-
-                if ((c == '=') || (c == '{'))
-                    return "";
-                else if ((c == ';') || (c == '}'))
-                {
-                    // Remove trailing whitespace before returning the line
-                    line.erase(line.find_last_not_of(" \n\r\t")+1);
-                    return line;
-                }
-                else if (::isspace(c))
-                {
-                    stream.read(&c, 1);
-                    if (!whitespaceFound)
+                    if ((c == '=') || (c == '{'))
                     {
-                        whitespaceFound = true;
-                        line.push_back(' ');
+                        line.clear();
+                        return;
+                    }
+                    else if ((c == ';') || (c == '}'))
+                    {
+                        // Remove whitespace in front and behind the value
+                        line.erase(0, std::min(line.find_first_not_of(" \n\r\t\v\f"), line.size()));
+                        line.erase(line.find_last_not_of(" \n\r\t\v\f")+1);
+                        return;
+                    }
+                    else if (isWhitespace(c))
+                    {
+                        ++m_position;
+                        if (!whitespaceFound)
+                        {
+                            whitespaceFound = true;
+                            line.push_back(' ');
+                        }
+                    }
+                    else
+                    {
+                        whitespaceFound = false;
+                        line.push_back(get());
                     }
                 }
-                else
-                {
-                    whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
-                }
-            }
 
-            return "";
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
-        {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
-
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
-
-            // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+                line.clear();
+            }
 
-            // Read the value
-            std::string line = trim(readLine(stream));
-            if (!line.empty())
+            // Splits a value like "[a, "b", c]" into its items
+            static void parseListItems(const std::string& line, std::vector<sf::String>& valueList)
             {
-                // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
-
-                // Create a value node to store the value
-                auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
-
-                // It might be a list node
-                if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                std::string item;
+                std::size_t i = 1;
+                while (i < line.size()-1)
                 {
-                    valueNode->listNode = true;
-                    if (line.size() >= 3)
+                    if (line[i] == ',')
+                    {
+                        i++;
+                        valueList.emplace_back(trim(item));
+                        item.clear();
+                    }
+                    else if (line[i] == '"')
                     {
-                        valueNode->valueList.push_back("");
+                        item.push_back(line[i]);
+                        i++;
 
-                        std::size_t i = 1;
+                        bool backslash = false;
                         while (i < line.size()-1)
                         {
-                            if (line[i] == ',')
+                            item.push_back(line[i]);
+
+                            if (line[i] == '"' && !backslash)
                             {
                                 i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
+                                break;
                             }
-                            else if (line[i] == '"')
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-
-                                bool backslash = false;
-                                while (i < line.size()-1)
-                                {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
 
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
-                                }
-                            }
+                            if (line[i] == '\\' && !backslash)
+                                backslash = true;
                             else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-                            }
-                        }
+                                backslash = false;
 
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
+                            i++;
+                        }
+                    }
+                    else
+                    {
+                        item.push_back(line[i]);
+                        i++;
                     }
                 }
 
-                node->propertyValuePairs[toLower(key)] = std::move(valueNode);
-                return "";
+                valueList.emplace_back(trim(item));
             }
-            else
+
+            std::string parseKeyValue(const std::unique_ptr<DataIO::Node>& node, const std::string& key)
             {
-                if (stream.peek() == EOF)
-                    return "Found EOF while trying to read a value.";
+                // Skip the assignment symbol and the whitespace behind it
+                ++m_position;
+
+                std::string error;
+                if (skipWhitespaceAndComments(true, error))
+                    return error;
+
+                // Check for subsection as value
+                if (peek() == '{')
+                    return parseSection(node, key);
+
+                // Read the value
+                std::string& line = m_lineBuffer;
+                readLine(line);
+                if (!line.empty())
+                {
+                    // Remove the ';' if it is there
+                    if (peek() == ';')
+                        ++m_position;
+
+                    // Create a value node to store the value
+                    auto valueNode = std::make_unique<DataIO::ValueNode>();
+                    valueNode->value = line;
+
+                    // It might be a list node
+                    if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
+                    {
+                        valueNode->listNode = true;
+                        if (line.size() >= 3)
+                            parseListItems(line, valueNode->valueList);
+                    }
+
+                    node->propertyValuePairs[toLower(key)] = std::move(valueNode);
+                    return "";
+                }
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
-                    if (chr == '=')
+                    if (peek() == EOF)
+                        return "Found EOF while trying to read a value.";
+                    else if (peek() == '=')
                         return "Found '=' while trying to read a value.";
-                    else if (chr == '{')
+                    else if (peek() == '{')
                         return "Found '{' while trying to read a value.";
                     else
                         return "Found empty value.";
                 }
             }
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
-        {
-            // Create a new node for this section
-            auto sectionNode = std::make_unique<DataIO::Node>();
-            sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
-
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
-
-            while (stream.peek() != EOF)
+            std::string parseSection(const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
             {
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
+                // Create a new node for this section
+                auto sectionNode = std::make_unique<DataIO::Node>();
+                sectionNode->parent = node.get();
+                sectionNode->name = sectionName;
 
-                std::string word = readWord(stream);
-                if (word == "")
+                // Skip the brace
+                ++m_position;
+
+                std::string error;
+                while (peek() != EOF)
                 {
-                    if (stream.peek() == EOF)
-                        return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
-                    {
-                        node->children.push_back(std::move(sectionNode));
+                    if (skipWhitespaceAndComments(true, error))
+                        return error;
 
-                        stream.read(&chr, 1);
+                    const std::string word = readWord();
+                    if (word.empty())
+                    {
+                        if (peek() == EOF)
+                            return "Found EOF while trying to read property or nested section name.";
+                        else if (peek() == '}')
+                        {
+                            node->children.push_back(std::move(sectionNode));
+                            ++m_position;
 
-                        // Ignore semicolon behind closing brace
-                        REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                            // Ignore semicolon behind closing brace
+                            if (skipWhitespaceAndComments(false, error))
+                                return error;
+                            if (peek() == ';')
+                                ++m_position;
 
-                        REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        return "";
+                            skipWhitespaceAndComments(false, error);
+                            return error;
+                        }
+                        else if (peek() != '{')
+                            return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(peek())) + "' instead.";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
-                }
 
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
-                {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    if (skipWhitespaceAndComments(true, error))
+                        return error;
+
+                    if (peek() == '{')
+                        error = parseSection(sectionNode, word);
+                    else if (peek() == '=')
+                        error = parseKeyValue(sectionNode, word);
+                    else
+                        return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(peek())) + "' instead.";
+
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+
+                return "Found EOF while reading section.";
+            }
+
+            std::string parseRootSection(const std::unique_ptr<DataIO::Node>& root)
+            {
+                std::string error;
+                if (skipWhitespaceAndComments(false, error))
+                    return error;
+
+                const std::string word = readWord();
+                if (word.empty())
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
-                    if (!error.empty())
+                    if (skipWhitespaceAndComments(true, error))
                         return error;
+                    if (peek() != '{')
+                        return "Expected section name, found '" + std::string(1, static_cast<char>(peek())) + "' instead.";
                 }
+
+                if (skipWhitespaceAndComments(true, error))
+                    return error;
+
+                if (peek() == '{')
+                    return parseSection(root, word);
+                else if (peek() == '=')
+                    return parseKeyValue(root, word);
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(peek())) + "' instead.";
             }
 
-            return "Found EOF while reading section.";
+        private:
+
+            const char* m_data;
+            std::size_t m_size;
+            std::size_t m_position = 0;
+            std::string m_lineBuffer;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Layout of a binary widget file (all integers are unsigned 32-bit little endian):
+        // - Header: magic bytes, version, string count, node count, property count and list item count
+        // - String table: offset and length of each string inside the string data
+        // - Node table: name, index of first child, child count, index of first property and property count
+        // - Property table: key, value, list flag, index of first list item and list item count
+        // - List item table: value of each list item
+        // - String data: the UTF-8 bytes of all strings, each distinct string is stored only once
+        // Nodes are stored in breadth-first order so that the children of a node are always consecutive.
+        const char binaryWidgetFileMagic[8] = {'T', 'G', 'U', 'I', '-', 'B', 'I', 'N'};
+        const std::uint32_t binaryWidgetFileVersion = 1;
+        const std::size_t binaryWidgetFileHeaderSize = sizeof(binaryWidgetFileMagic) + 5 * 4;
+        const std::size_t binaryStringRecordSize = 2 * 4;
+        const std::size_t binaryNodeRecordSize = 5 * 4;
+        const std::size_t binaryPropertyRecordSize = 5 * 4;
+        const std::size_t binaryListItemRecordSize = 4;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t readBinaryUint32(const char* data)
+        {
+            const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+            return static_cast<std::uint32_t>(bytes[0])
+                 | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                 | (static_cast<std::uint32_t>(bytes[2]) << 16)
+                 | (static_cast<std::uint32_t>(bytes[3]) << 24);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        void writeBinaryUint32(std::string& output, std::size_t value)
         {
-            REMOVE_WHITESPACE_AND_COMMENTS(false)
+            output.push_back(static_cast<char>(value & 0xFF));
+            output.push_back(static_cast<char>((value >> 8) & 0xFF));
+            output.push_back(static_cast<char>((value >> 16) & 0xFF));
+            output.push_back(static_cast<char>((value >> 24) & 0xFF));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            std::string word = readWord(stream);
-            if (word == "")
+        class BinaryStringTable
+        {
+        public:
+
+            std::uint32_t add(const std::string& str)
             {
-                REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                const auto result = m_indices.emplace(str, static_cast<std::uint32_t>(m_strings.size()));
+                if (result.second)
+                    m_strings.push_back(&result.first->first);
+
+                return result.first->second;
             }
 
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
-            else
-                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
-        }
+            std::uint32_t add(const sf::String& str)
+            {
+                const std::basic_string<sf::Uint8>& strUtf8 = str.toUtf8();
+                return add(std::string(strUtf8.begin(), strUtf8.end()));
+            }
+
+            const std::vector<const std::string*>& getStrings() const
+            {
+                return m_strings;
+            }
+
+        private:
+
+            std::unordered_map<std::string, std::uint32_t> m_indices;
+            std::vector<const std::string*> m_strings; // Points to the keys in m_indices, in the order they were added
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::vector<std::string> convertNodesToLines(const std::unique_ptr<DataIO::Node>& node)
+        class BinaryWidgetFileReader
         {
-            std::vector<std::string> output;
-            if (node->name.empty())
-                output.emplace_back("{");
-            else
-                output.emplace_back(node->name + " {");
+        public:
 
-            if (!node->propertyValuePairs.empty())
+            BinaryWidgetFileReader(const char* data, std::size_t size) :
+                m_data(data),
+                m_size(size)
             {
-                for (const auto& pair : node->propertyValuePairs)
-                    output.emplace_back("    " + pair.first + " = " + pair.second->value + ";");
+                if (!DataIO::isBinary(data, size))
+                    throw Exception{"Error while parsing binary widget file. The file doesn't start with the expected header."};
+
+                const std::uint32_t version = readBinaryUint32(data + sizeof(binaryWidgetFileMagic));
+                if (version != binaryWidgetFileVersion)
+                    throw Exception{"Error while parsing binary widget file. Version " + to_string(version) + " is not supported."};
+
+                m_stringCount = readBinaryUint32(data + sizeof(binaryWidgetFileMagic) + 4);
+                m_nodeCount = readBinaryUint32(data + sizeof(binaryWidgetFileMagic) + 8);
+                m_propertyCount = readBinaryUint32(data + sizeof(binaryWidgetFileMagic) + 12);
+                m_listItemCount = readBinaryUint32(data + sizeof(binaryWidgetFileMagic) + 16);
+
+                // 64-bit arithmetic is used so that a corrupt file can't cause the sizes to overflow
+                m_stringTableOffset = binaryWidgetFileHeaderSize;
+                m_nodeTableOffset = m_stringTableOffset + std::uint64_t{m_stringCount} * binaryStringRecordSize;
+                m_propertyTableOffset = m_nodeTableOffset + std::uint64_t{m_nodeCount} * binaryNodeRecordSize;
+                m_listItemTableOffset = m_propertyTableOffset + std::uint64_t{m_propertyCount} * binaryPropertyRecordSize;
+                m_stringDataOffset = m_listItemTableOffset + std::uint64_t{m_listItemCount} * binaryListItemRecordSize;
+                if (m_stringDataOffset > size)
+                    throw Exception{"Error while parsing binary widget file. The file is truncated."};
+                if (m_nodeCount == 0)
+                    throw Exception{"Error while parsing binary widget file. The file doesn't contain a root node."};
             }
 
-            if (node->propertyValuePairs.size() > 0 && node->children.size() > 0)
-                output.emplace_back("");
-
-            if (!node->children.empty())
+            std::unique_ptr<DataIO::Node> read() const
             {
-                for (std::size_t i = 0; i < node->children.size(); ++i)
+                auto root = std::make_unique<DataIO::Node>();
+
+                std::vector<DataIO::Node*> nodes(m_nodeCount, nullptr);
+                nodes[0] = root.get();
+                for (std::uint32_t i = 0; i < m_nodeCount; ++i)
                 {
-                    for (const auto& line : convertNodesToLines(node->children[i]))
+                    DataIO::Node* node = nodes[i];
+                    if (!node)
+                        throw Exception{"Error while parsing binary widget file. Node " + to_string(i) + " has no parent."};
+
+                    const char* record = m_data + m_nodeTableOffset + std::uint64_t{i} * binaryNodeRecordSize;
+                    node->name = getString(readBinaryUint32(record));
+
+                    // Children always come after their parent, which also guarantees that there are no cycles in the tree
+                    const std::uint32_t firstChild = readBinaryUint32(record + 4);
+                    const std::uint32_t childCount = readBinaryUint32(record + 8);
+                    if ((childCount > 0) && ((firstChild <= i) || (std::uint64_t{firstChild} + childCount > m_nodeCount)))
+                        throw Exception{"Error while parsing binary widget file. Node " + to_string(i) + " has invalid children."};
+
+                    node->children.reserve(childCount);
+                    for (std::uint32_t j = firstChild; j < firstChild + childCount; ++j)
                     {
-                        if (!line.empty())
-                            output.emplace_back("    " + line);
-                        else
-                            output.emplace_back("");
+                        if (nodes[j])
+                            throw Exception{"Error while parsing binary widget file. Node " + to_string(j) + " has multiple parents."};
+
+                        node->children.push_back(std::make_unique<DataIO::Node>());
+                        node->children.back()->parent = node;
+                        nodes[j] = node->children.back().get();
                     }
 
-                    if (i < node->children.size() - 1)
-                        output.emplace_back("");
+                    const std::uint32_t firstProperty = readBinaryUint32(record + 12);
+                    const std::uint32_t propertyCount = readBinaryUint32(record + 16);
+                    if (std::uint64_t{firstProperty} + propertyCount > m_propertyCount)
+                        throw Exception{"Error while parsing binary widget file. Node " + to_string(i) + " has invalid properties."};
+
+                    for (std::uint32_t j = firstProperty; j < firstProperty + propertyCount; ++j)
+                        readProperty(*node, j);
                 }
+
+                return root;
             }
 
-            output.emplace_back("}");
-            return output;
-        }
+        private:
+
+            void readProperty(DataIO::Node& node, std::uint32_t index) const
+            {
+                const char* record = m_data + m_propertyTableOffset + std::uint64_t{index} * binaryPropertyRecordSize;
+
+                auto valueNode = std::make_unique<DataIO::ValueNode>();
+                valueNode->value = getUtf32String(readBinaryUint32(record + 4));
+                valueNode->listNode = (readBinaryUint32(record + 8) != 0);
+
+                const std::uint32_t firstListItem = readBinaryUint32(record + 12);
+                const std::uint32_t listItemCount = readBinaryUint32(record + 16);
+                if (std::uint64_t{firstListItem} + listItemCount > m_listItemCount)
+                    throw Exception{"Error while parsing binary widget file. Property " + to_string(index) + " has invalid list items."};
+
+                valueNode->valueList.reserve(listItemCount);
+                for (std::uint32_t i = firstListItem; i < firstListItem + listItemCount; ++i)
+                    valueNode->valueList.push_back(getUtf32String(readBinaryUint32(m_data + m_listItemTableOffset + std::uint64_t{i} * binaryListItemRecordSize)));
+
+                // The properties were emitted in sorted order, so they can be appended to the map without searching
+                node.propertyValuePairs.emplace_hint(node.propertyValuePairs.end(), getString(readBinaryUint32(record)), std::move(valueNode));
+            }
+
+            std::pair<const char*, std::size_t> getStringData(std::uint32_t index) const
+            {
+                if (index >= m_stringCount)
+                    throw Exception{"Error while parsing binary widget file. String " + to_string(index) + " doesn't exist."};
+
+                const char* record = m_data + m_stringTableOffset + std::uint64_t{index} * binaryStringRecordSize;
+                const std::uint32_t offset = readBinaryUint32(record);
+                const std::uint32_t length = readBinaryUint32(record + 4);
+                if (m_stringDataOffset + offset + length > m_size)
+                    throw Exception{"Error while parsing binary widget file. String " + to_string(index) + " lies outside the file."};
+
+                return {m_data + m_stringDataOffset + offset, length};
+            }
+
+            std::string getString(std::uint32_t index) const
+            {
+                const auto str = getStringData(index);
+                return {str.first, str.second};
+            }
+
+            sf::String getUtf32String(std::uint32_t index) const
+            {
+                const auto str = getStringData(index);
+                return sf::String::fromUtf8(str.first, str.first + str.second);
+            }
+
+        private:
+
+            const char* m_data;
+            std::size_t m_size;
+            std::uint32_t m_stringCount = 0;
+            std::uint32_t m_nodeCount = 0;
+            std::uint32_t m_propertyCount = 0;
+            std::uint32_t m_listItemCount = 0;
+            std::uint64_t m_stringTableOffset = 0;
+            std::uint64_t m_nodeTableOffset = 0;
+            std::uint64_t m_propertyTableOffset = 0;
+            std::uint64_t m_listItemTableOffset = 0;
+            std::uint64_t m_stringDataOffset = 0;
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
@@ -496,51 +701,167 @@ namespace tgui
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
     {
-        auto root = std::make_unique<Node>();
+        // Parse the part of the stream that wasn't read yet
+        const std::string contents{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+        return parse(contents.data(), contents.size());
+    }
 
-        std::string error;
-        while (stream.peek() != EOF)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
+    {
+        return WidgetFileParser{data, size}.parse();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
+    {
+        StreamWriter writer{stream};
+        for (const auto& pair : rootNode->propertyValuePairs)
+            writer.writeProperty(pair.first, pair.second->value);
+
+        for (const auto& child : rootNode->children)
+            writer.writeSection(*child);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DataIO::StreamWriter::StreamWriter(std::ostream& stream) :
+        m_stream(stream)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::StreamWriter::writeProperty(const std::string& key, const sf::String& value)
+    {
+        assert(!m_sectionsWritten); // Properties of the root node have to be written before the sections
+        m_stream << key << " = " << value.toAnsiString() << ";\n";
+        m_propertiesWritten = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::StreamWriter::writeSection(const Node& node)
+    {
+        // Sections are separated from each other and from the root properties by an empty line
+        if (m_propertiesWritten || m_sectionsWritten)
+            m_stream << '\n';
+
+        std::string indentation;
+        writeSection(node, indentation);
+        m_sectionsWritten = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::StreamWriter::writeSection(const Node& node, std::string& indentation)
+    {
+        if (node.name.empty())
+            m_stream << indentation << "{\n";
+        else
+            m_stream << indentation << node.name << " {\n";
+
+        indentation += "    ";
+        for (const auto& pair : node.propertyValuePairs)
+            m_stream << indentation << pair.first << " = " << pair.second->value.toAnsiString() << ";\n";
+
+        if (!node.propertyValuePairs.empty() && !node.children.empty())
+            m_stream << '\n';
+
+        for (std::size_t i = 0; i < node.children.size(); ++i)
         {
-            error = parseRootSection(stream, root);
-            if (!error.empty())
-            {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
-                    throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
-            }
+            if (i > 0)
+                m_stream << '\n';
+
+            writeSection(*node.children[i], indentation);
         }
 
-        return root;
+        indentation.erase(indentation.size() - 4);
+        m_stream << indentation << "}\n";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
+    bool DataIO::isBinary(const char* data, std::size_t size)
     {
-        for (const auto& pair : rootNode->propertyValuePairs)
-            stream << pair.first << " = " << pair.second->value.toAnsiString() << ";" << std::endl;
+        return (size >= binaryWidgetFileHeaderSize)
+            && std::equal(std::begin(binaryWidgetFileMagic), std::end(binaryWidgetFileMagic), data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (rootNode->propertyValuePairs.size() > 0 && rootNode->children.size() > 0)
-            stream << std::endl;
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(const char* data, std::size_t size)
+    {
+        return BinaryWidgetFileReader{data, size}.read();
+    }
 
-        std::vector<std::string> output;
-        for (std::size_t i = 0; i < rootNode->children.size(); ++i)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::ostream& stream)
+    {
+        BinaryStringTable strings;
+        std::string nodeTable;
+        std::string propertyTable;
+        std::string listItemTable;
+        std::size_t propertyCount = 0;
+        std::size_t listItemCount = 0;
+
+        // Visit the nodes in breadth-first order, so that the children of each node get consecutive indices
+        std::vector<const Node*> nodes{rootNode.get()};
+        for (std::size_t i = 0; i < nodes.size(); ++i)
         {
-            for (const auto& line : convertNodesToLines(rootNode->children[i]))
-                output.emplace_back(std::move(line));
+            const Node* node = nodes[i];
+            writeBinaryUint32(nodeTable, strings.add(node->name));
+            writeBinaryUint32(nodeTable, nodes.size());
+            writeBinaryUint32(nodeTable, node->children.size());
+            writeBinaryUint32(nodeTable, propertyCount);
+            writeBinaryUint32(nodeTable, node->propertyValuePairs.size());
 
-            if (i < rootNode->children.size()-1)
-                output.emplace_back("");
+            for (const auto& child : node->children)
+                nodes.push_back(child.get());
+
+            for (const auto& pair : node->propertyValuePairs)
+            {
+                writeBinaryUint32(propertyTable, strings.add(pair.first));
+                writeBinaryUint32(propertyTable, strings.add(pair.second->value));
+                writeBinaryUint32(propertyTable, pair.second->listNode ? 1 : 0);
+                writeBinaryUint32(propertyTable, listItemCount);
+                writeBinaryUint32(propertyTable, pair.second->valueList.size());
+
+                for (const auto& item : pair.second->valueList)
+                    writeBinaryUint32(listItemTable, strings.add(item));
+
+                listItemCount += pair.second->valueList.size();
+            }
+
+            propertyCount += node->propertyValuePairs.size();
+        }
+
+        std::string stringTable;
+        std::size_t stringDataSize = 0;
+        for (const auto* str : strings.getStrings())
+        {
+            writeBinaryUint32(stringTable, stringDataSize);
+            writeBinaryUint32(stringTable, str->size());
+            stringDataSize += str->size();
         }
 
-        for (const auto& line : output)
-            stream << line << std::endl;
+        std::string header(std::begin(binaryWidgetFileMagic), std::end(binaryWidgetFileMagic));
+        writeBinaryUint32(header, binaryWidgetFileVersion);
+        writeBinaryUint32(header, strings.getStrings().size());
+        writeBinaryUint32(header, nodes.size());
+        writeBinaryUint32(header, propertyCount);
+        writeBinaryUint32(header, listItemCount);
+
+        stream.write(header.data(), static_cast<std::streamsize>(header.size()));
+        stream.write(stringTable.data(), static_cast<std::streamsize>(stringTable.size()));
+        stream.write(nodeTable.data(), static_cast<std::streamsize>(nodeTable.size()));
+        stream.write(propertyTable.data(), static_cast<std::streamsize>(propertyTable.size()));
+        stream.write(listItemTable.data(), static_cast<std::streamsize>(listItemTable.size()));
+        for (const auto* str : strings.getStrings())
+            stream.write(str->data(), static_cast<std::streamsize>(str->size()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
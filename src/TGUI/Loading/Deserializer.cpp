@@ -95,18 +95,10 @@ namespace tgui
             if (filename.isEmpty())
                 return Font{};
 
-            // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
-#ifdef SFML_SYSTEM_WINDOWS
-            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.getSize() <= 1) || (filename[1] != ':')))
-#else
-            if (filename[0] != '/')
-#endif
-                font->loadFromFile(getResourcePath() + filename);
-            else
-                font->loadFromFile(filename);
+            // Fonts are shared between everything that loads the same file
+            auto font = Font::loadFromCache(filename);
 
-            // We create the SFML font manually first, as passing the string to the Font constructor would cause
+            // We get the SFML font manually first, as passing the string to the Font constructor would cause
             // an endless recursive call to this function.
             return Font{font};
         }
@@ -381,8 +373,7 @@ namespace tgui
 
         ObjectConverter deserializeRendererData(const std::string& renderer)
         {
-            std::stringstream ss{renderer};
-            auto node = DataIO::parse(ss);
+            auto node = DataIO::parse(renderer.data(), renderer.size());
 
             // The root node should contain exactly one child which is the node we need
             if (node->propertyValuePairs.empty() && (node->children.size() == 1))
@@ -175,14 +175,15 @@ namespace tgui
 
             std::string result = "\"" + texture.getId() + "\"";
 
-            if ((texture.getData()->rect != sf::IntRect{}) && texture.getData()->image
-             && (texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(texture.getData()->image->getSize().x), static_cast<int>(texture.getData()->image->getSize().y)}))
+            // When the image wasn't kept in memory, the part rect is always written as it can't be compared with the image size
+            if ((texture.getData()->rect != sf::IntRect{}) && (!texture.getData()->alphaMask.empty()
+             || (texture.getData()->image && texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(texture.getData()->image->getSize().x), static_cast<int>(texture.getData()->image->getSize().y)})))
             {
                 result += " Part(" + to_string(texture.getData()->rect.left) + ", " + to_string(texture.getData()->rect.top)
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getImageSize().x), static_cast<int>(texture.getImageSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -229,8 +230,8 @@ namespace tgui
                 sf::String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
-                    node->children.push_back(DataIO::parse(ss));
+                    const std::string str = ObjectConverter{pair.second}.getString();
+                    node->children.push_back(DataIO::parse(str.data(), str.size()));
                     node->children.back()->name = pair.first;
                 }
                 else
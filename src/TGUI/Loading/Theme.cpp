@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -304,12 +305,8 @@ namespace tgui
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
-
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
+            renderer->propertyValuePairs = std::move(m_themeLoader->loadRenderer(m_primary, pair.first)->propertyValuePairs);
 
             // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
             auto oldIt = oldData->propertyValuePairs.begin();
@@ -367,11 +364,9 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
+        // An empty renderer remains in the cache when the theme loader throws
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
+        m_renderers[lowercaseSecondary] = m_themeLoader->loadRenderer(m_primary, lowercaseSecondary);
         return m_renderers[lowercaseSecondary];
     }
 
@@ -391,10 +386,7 @@ namespace tgui
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
+        m_renderers[lowercaseSecondary] = m_themeLoader->loadRenderer(m_primary, lowercaseSecondary);
         return m_renderers[lowercaseSecondary];
     }
 
@@ -428,6 +420,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::preloadTexturesAsync(std::function<void(std::size_t loadedCount, std::size_t totalCount)> progressCallback)
+    {
+        TextureManager::preloadTexturesAsync(m_themeLoader->getTextureIds(m_primary), std::move(progressCallback));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Theme::setThemeLoader(std::shared_ptr<BaseThemeLoader> themeLoader)
     {
         m_themeLoader = themeLoader;
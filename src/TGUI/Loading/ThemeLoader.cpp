@@ -26,6 +26,7 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
@@ -52,7 +53,9 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::map<std::string, std::map<std::string, std::shared_ptr<RendererData>>> DefaultThemeLoader::m_renderersCache;
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, std::vector<sf::String>> DefaultThemeLoader::m_textureIdsCache;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -133,6 +136,129 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::shared_ptr<RendererData> compileThemeSection(const std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                                          std::map<std::string, std::shared_ptr<RendererData>>& renderers, const DataIO::Node& node);
+
+        // Returns the renderer data of a section in the theme file, the section is only converted the first time it is requested
+        std::shared_ptr<RendererData> compileThemeSectionByName(const std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                                                std::map<std::string, std::shared_ptr<RendererData>>& renderers, const std::string& name)
+        {
+            const auto renderersIt = renderers.find(name);
+            if (renderersIt != renderers.end())
+            {
+                // A null pointer means that the section is still being converted
+                if (!renderersIt->second)
+                    throw Exception{"Circular reference to '" + name + "' encountered."};
+
+                return renderersIt->second;
+            }
+
+            const auto sectionsIt = sections.find(name);
+            if (sectionsIt == sections.end())
+                throw Exception{"Undefined reference to '" + name + "' encountered."};
+
+            renderers[name] = nullptr;
+            auto rendererData = compileThemeSection(sections, renderers, *sectionsIt->second.get());
+            renderers[name] = rendererData;
+            return rendererData;
+        }
+
+        // Converts a section into renderer data. Nested sections and references become renderer data as well, so that they
+        // don't have to be emitted as text and parsed again each time a renderer is created.
+        std::shared_ptr<RendererData> compileThemeSection(const std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                                                          std::map<std::string, std::shared_ptr<RendererData>>& renderers, const DataIO::Node& node)
+        {
+            auto rendererData = RendererData::create();
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                // Check if this property is a reference to another section
+                if (!pair.second->value.isEmpty() && (pair.second->value[0] == '&'))
+                {
+                    const std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, pair.second->value.substring(1)).getString());
+                    rendererData->propertyValuePairs[toLower(pair.first)] = ObjectConverter(compileThemeSectionByName(sections, renderers, name));
+                }
+                else
+                    rendererData->propertyValuePairs[toLower(pair.first)] = ObjectConverter(pair.second->value);
+            }
+
+            for (const auto& child : node.children)
+                rendererData->propertyValuePairs[toLower(child->name)] = ObjectConverter(compileThemeSection(sections, renderers, *child));
+
+            return rendererData;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Copies the renderer data, including its nested renderers which would otherwise still be shared with the original
+        std::shared_ptr<RendererData> copyThemeRendererData(const RendererData& rendererData)
+        {
+            auto copy = RendererData::create(rendererData.propertyValuePairs);
+            for (auto& pair : copy->propertyValuePairs)
+            {
+                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                    pair.second = ObjectConverter(copyThemeRendererData(*pair.second.getRenderer()));
+            }
+
+            return copy;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Finds the filename in a serialized texture, the same way as the texture deserializer does it
+        std::string getSerializedTextureId(const std::string& value)
+        {
+            if (value.empty() || (toLower(value) == "none") || (value == "null") || (value == "nullptr"))
+                return "";
+
+            if (value[0] != '"')
+            {
+            #ifdef SFML_SYSTEM_WINDOWS
+                if ((value[0] != '/') && (value[0] != '\\') && ((value.size() <= 1) || (value[1] != ':')))
+            #else
+                if (value[0] != '/')
+            #endif
+                    return getResourcePath() + value;
+                else
+                    return value;
+            }
+
+            std::string filename;
+            char prev = '\0';
+            for (auto c = value.begin() + 1; c != value.end(); ++c)
+            {
+                if ((*c == '"') && (prev != '\\'))
+                    return filename;
+
+                prev = *c;
+                filename.push_back(*c);
+            }
+
+            return ""; // The closing quote is missing, the deserializer will report the error
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void findTextureIds(std::set<const DataIO::Node*>& handledSections, const std::unique_ptr<DataIO::Node>& node, std::set<std::string>& textureIds)
+        {
+            for (const auto& pair : node->propertyValuePairs)
+            {
+                if ((pair.first.size() >= 7) && (toLower(pair.first.substr(0, 7)) == "texture"))
+                {
+                    const std::string id = getSerializedTextureId(pair.second->value.toAnsiString());
+                    if (!id.empty())
+                        textureIds.insert(id);
+                }
+            }
+
+            for (const auto& child : node->children)
+            {
+                if (handledSections.insert(child.get()).second)
+                    findTextureIds(handledSections, child, textureIds);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +269,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<sf::String> BaseThemeLoader::getTextureIds(const std::string&)
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> BaseThemeLoader::loadRenderer(const std::string& primary, const std::string& secondary)
+    {
+        auto rendererData = RendererData::create();
+        for (const auto& property : load(primary, secondary))
+            rendererData->propertyValuePairs[property.first] = ObjectConverter(property.second);
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -150,10 +294,15 @@ namespace tgui
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            m_renderersCache.erase(filename);
+            m_textureIdsCache.erase(filename);
         }
         else
         {
+            m_renderersCache.clear();
             m_propertiesCache.clear();
+            m_textureIdsCache.clear();
         }
     }
 
@@ -165,29 +314,51 @@ namespace tgui
             return;
 
         // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        if (m_renderersCache.find(filename) == m_renderersCache.end())
         {
-            std::string resourcePath;
-            auto slashPos = filename.find_last_of("/\\");
-            if (slashPos != std::string::npos)
-                resourcePath = filename.substr(0, slashPos+1);
+            const auto root = parseThemeFile(filename);
 
-            std::stringstream fileContents;
-            readFile(filename, fileContents);
+            // Get a list of section names and map them to their nodes (needed for resolving references)
+            std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+            for (const auto& child : root->children)
+            {
+                std::string name = toLower(Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString());
+                sections.emplace(name, std::cref(child));
+            }
 
-            std::unique_ptr<DataIO::Node> root = DataIO::parse(fileContents);
+            // Convert all sections to renderer data
+            std::map<std::string, std::shared_ptr<RendererData>> renderers;
+            for (const auto& section : sections)
+                compileThemeSectionByName(sections, renderers, section.first);
 
-            if (root->propertyValuePairs.size() != 0)
-                throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
+            // Remember which images are used, so that they can be loaded in advance
+            std::set<const DataIO::Node*> handledTextureSections;
+            std::set<std::string> textureIds;
+            findTextureIds(handledTextureSections, root, textureIds);
+            m_textureIdsCache[filename].assign(textureIds.begin(), textureIds.end());
 
-            // Turn texture and font filenames into paths relative to the theme file
-            if (!resourcePath.empty())
-            {
-                std::set<const DataIO::Node*> handledSections;
-                injectThemePath(handledSections, root, resourcePath);
-            }
+            // The parsed file is no longer needed, it is only parsed again when load is called for this file
+            m_renderersCache[filename] = std::move(renderers);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        const std::string lowercaseClassName = toLower(section);
+
+        // An empty filename is not considered an error and will result in an empty property list
+        if (filename.empty())
+            return m_propertiesCache[""][lowercaseClassName];
+
+        // The property-value pairs are only serialized when they are requested for the first time
+        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        {
+            const auto root = parseThemeFile(filename);
 
-            // Get a list of section names and map them to their nodes (needed for resolving references)
             std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
             for (const auto& child : root->children)
             {
@@ -199,39 +370,53 @@ namespace tgui
             resolveReferences(sections, root);
 
             // Cache all propery value pairs
-            for (const auto& section : sections)
+            auto& propertiesCache = m_propertiesCache[filename];
+            for (const auto& sectionPair : sections)
             {
-                const auto& child = section.second;
-                const std::string& name = section.first;
+                const auto& child = sectionPair.second;
+                auto& properties = propertiesCache[sectionPair.first];
                 for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][toLower(pair.first)] = pair.second->value;
+                    properties[toLower(pair.first)] = pair.second->value;
 
                 for (const auto& nestedProperty : child.get()->children)
                 {
                     std::stringstream ss;
                     DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
+                    properties[toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
                 }
             }
         }
+
+        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        return m_propertiesCache[filename][lowercaseClassName];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<sf::String, sf::String>& DefaultThemeLoader::load(const std::string& filename, const std::string& section)
+    std::shared_ptr<RendererData> DefaultThemeLoader::loadRenderer(const std::string& filename, const std::string& section)
     {
         preload(filename);
 
-        const std::string lowercaseClassName = toLower(section);
-
-        // An empty filename is not considered an error and will result in an empty property list
+        // An empty filename is not considered an error and will result in an empty renderer
         if (filename.empty())
-            return m_propertiesCache[""][lowercaseClassName];
+            return RendererData::create();
 
-        if (m_propertiesCache[filename].find(lowercaseClassName) == m_propertiesCache[filename].end())
+        const auto& renderers = m_renderersCache[filename];
+        const auto renderersIt = renderers.find(toLower(section));
+        if (renderersIt == renderers.end())
             throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
 
-        return m_propertiesCache[filename][lowercaseClassName];
+        return copyThemeRendererData(*renderersIt->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<sf::String> DefaultThemeLoader::getTextureIds(const std::string& filename)
+    {
+        preload(filename);
+        return m_textureIdsCache[filename];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,8 +425,44 @@ namespace tgui
     {
         if (filename.empty())
             return true;
+
+        const auto renderersIt = m_renderersCache.find(filename);
+        if (renderersIt == m_renderersCache.end())
+            return false;
+
+        return renderersIt->second.find(toLower(section)) != renderersIt->second.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DefaultThemeLoader::parseThemeFile(const std::string& filename) const
+    {
+        std::string resourcePath;
+        auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != std::string::npos)
+            resourcePath = filename.substr(0, slashPos+1);
+
+        std::stringstream fileContents;
+        readFile(filename, fileContents);
+
+        const std::string contents = fileContents.str();
+        std::unique_ptr<DataIO::Node> root;
+        if (DataIO::isBinary(contents.data(), contents.size()))
+            root = DataIO::parseBinary(contents.data(), contents.size());
         else
-            return m_propertiesCache[filename].find(toLower(section)) != m_propertiesCache[filename].end();
+            root = DataIO::parse(contents.data(), contents.size());
+
+        if (root->propertyValuePairs.size() != 0)
+            throw Exception{"Unexpected result while loading theme file '" + filename + "'. Root property-value pair found."};
+
+        // Turn texture and font filenames into paths relative to the theme file
+        if (!resourcePath.empty())
+        {
+            std::set<const DataIO::Node*> handledSections;
+            injectThemePath(handledSections, root, resourcePath);
+        }
+
+        return root;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,7 +508,7 @@ namespace tgui
             AAsset_read(asset, buffer, assetLength);
             buffer[assetLength] = 0;
 
-            contents << buffer;
+            contents.write(buffer, assetLength);
 
             AAsset_close(asset);
             delete[] buffer;
@@ -297,7 +518,7 @@ namespace tgui
         else
     #endif
         {
-            std::ifstream file{fullFilename};
+            std::ifstream file{fullFilename, std::ios::binary};
             if (!file.is_open())
                 throw Exception{"Failed to open theme file '" + fullFilename + "'."};
 
@@ -0,0 +1,161 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/MappedFile.hpp>
+#include <fstream>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #ifndef NOMINMAX // MinGW already defines this which causes a warning without this check
+        #define NOMINMAX
+    #endif
+    #define NOMB
+    #define VC_EXTRALEAN
+    #define WIN32_LEAN_AND_MEAN
+    #include <Windows.h>
+#elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_FREEBSD) || defined(SFML_SYSTEM_MACOS)
+    #define TGUI_USE_MMAP
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        MappedFile::~MappedFile()
+        {
+            close();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool MappedFile::open(const std::string& filename)
+        {
+            close();
+
+#if defined(SFML_SYSTEM_WINDOWS)
+            const HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file != INVALID_HANDLE_VALUE)
+            {
+                LARGE_INTEGER fileSize;
+                if (GetFileSizeEx(file, &fileSize) && (fileSize.QuadPart > 0))
+                {
+                    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (mapping != nullptr)
+                    {
+                        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                        if (view != nullptr)
+                        {
+                            m_data = static_cast<const char*>(view);
+                            m_size = static_cast<std::size_t>(fileSize.QuadPart);
+                            m_mapping = mapping;
+                            CloseHandle(file);
+                            return true;
+                        }
+
+                        CloseHandle(mapping);
+                    }
+                }
+
+                CloseHandle(file);
+            }
+#elif defined(TGUI_USE_MMAP)
+            const int file = ::open(filename.c_str(), O_RDONLY);
+            if (file >= 0)
+            {
+                struct stat fileInfo;
+                if ((fstat(file, &fileInfo) == 0) && (fileInfo.st_size > 0))
+                {
+                    void* view = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+                    if (view != MAP_FAILED)
+                    {
+                        m_data = static_cast<const char*>(view);
+                        m_size = static_cast<std::size_t>(fileInfo.st_size);
+                        m_mapping = view;
+                        ::close(file);
+                        return true;
+                    }
+                }
+
+                ::close(file);
+            }
+#endif
+
+            // Read the file into memory when it couldn't be mapped (e.g. because it is empty or mapping isn't supported)
+            std::ifstream in{filename, std::ios::binary};
+            if (!in.is_open())
+                return false;
+
+            m_buffer.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+            m_data = m_buffer.empty() ? nullptr : m_buffer.data();
+            m_size = m_buffer.size();
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void MappedFile::close()
+        {
+            if (m_mapping)
+            {
+#if defined(SFML_SYSTEM_WINDOWS)
+                UnmapViewOfFile(m_data);
+                CloseHandle(static_cast<HANDLE>(m_mapping));
+#elif defined(TGUI_USE_MMAP)
+                munmap(m_mapping, m_size);
+#endif
+                m_mapping = nullptr;
+            }
+
+            m_buffer.clear();
+            m_data = nullptr;
+            m_size = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const char* MappedFile::getData() const
+        {
+            return m_data;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t MappedFile::getSize() const
+        {
+            return m_size;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
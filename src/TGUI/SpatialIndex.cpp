@@ -0,0 +1,302 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SpatialIndex.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        namespace
+        {
+            // Widgets that would cover more cells than this are checked for every query instead of being stored in the grid
+            const int maxCellsPerWidget = 1024;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        SpatialIndex::SpatialIndex(float cellSize) :
+            m_cellSize{cellSize > 0 ? cellSize : 64}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        float SpatialIndex::getCellSize() const
+        {
+            return m_cellSize;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::insert(Widget* widget, FloatRect bounds, bool unbounded)
+        {
+            assert(m_entries.find(widget) == m_entries.end());
+
+            Entry entry;
+            entry.zOrder = ++m_topZOrder;
+            calculateCells(entry, bounds, unbounded);
+
+            addToCells(widget, entry);
+            m_entries[widget] = entry;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::update(Widget* widget, FloatRect bounds, bool unbounded)
+        {
+            const auto it = m_entries.find(widget);
+            if (it == m_entries.end())
+                return;
+
+            Entry newEntry = it->second;
+            calculateCells(newEntry, bounds, unbounded);
+
+            // Nothing has to change when the widget still covers the same cells
+            const Entry& oldEntry = it->second;
+            if ((newEntry.unbounded == oldEntry.unbounded) && (newEntry.left == oldEntry.left) && (newEntry.top == oldEntry.top)
+             && (newEntry.right == oldEntry.right) && (newEntry.bottom == oldEntry.bottom))
+                return;
+
+            removeFromCells(widget, oldEntry);
+            addToCells(widget, newEntry);
+            it->second = newEntry;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::remove(Widget* widget)
+        {
+            const auto it = m_entries.find(widget);
+            if (it == m_entries.end())
+                return;
+
+            removeFromCells(widget, it->second);
+            m_entries.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::clear()
+        {
+            m_cells.clear();
+            m_entries.clear();
+            m_unboundedWidgets.clear();
+            m_topZOrder = 0;
+            m_bottomZOrder = 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::moveToFront(Widget* widget)
+        {
+            const auto it = m_entries.find(widget);
+            if (it != m_entries.end())
+                it->second.zOrder = ++m_topZOrder;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::moveToBack(Widget* widget)
+        {
+            const auto it = m_entries.find(widget);
+            if (it != m_entries.end())
+                it->second.zOrder = --m_bottomZOrder;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::setZOrder(const std::vector<std::shared_ptr<Widget>>& widgets)
+        {
+            m_topZOrder = 0;
+            m_bottomZOrder = 0;
+            for (const auto& widget : widgets)
+            {
+                const auto it = m_entries.find(widget.get());
+                if (it != m_entries.end())
+                    it->second.zOrder = ++m_topZOrder;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<Widget*>& SpatialIndex::query(Vector2f pos) const
+        {
+            m_queryResult = m_unboundedWidgets;
+
+            const auto cellIt = m_cells.find(getCellKey(static_cast<int>(std::floor(pos.x / m_cellSize)),
+                                                        static_cast<int>(std::floor(pos.y / m_cellSize))));
+            if (cellIt != m_cells.end())
+                m_queryResult.insert(m_queryResult.end(), cellIt->second.begin(), cellIt->second.end());
+
+            std::sort(m_queryResult.begin(), m_queryResult.end(), [this](Widget* left, Widget* right){
+                    return m_entries.at(left).zOrder > m_entries.at(right).zOrder;
+                });
+
+            return m_queryResult;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        const std::vector<Widget*>& SpatialIndex::query(const FloatRect& area) const
+        {
+            m_queryResult = m_unboundedWidgets;
+
+            Entry range;
+            calculateCells(range, area, false);
+
+            const auto cellCount = static_cast<std::size_t>(range.right - range.left + 1) * static_cast<std::size_t>(range.bottom - range.top + 1);
+            if (range.unbounded || (cellCount > m_cells.size()))
+            {
+                // When the area covers more cells than there are filled ones, it is faster to check the widgets themselves
+                for (const auto& pair : m_entries)
+                {
+                    const Entry& entry = pair.second;
+                    if (entry.unbounded)
+                        continue;
+
+                    if (range.unbounded
+                     || ((entry.left <= range.right) && (range.left <= entry.right) && (entry.top <= range.bottom) && (range.top <= entry.bottom)))
+                    {
+                        m_queryResult.push_back(pair.first);
+                    }
+                }
+            }
+            else
+            {
+                for (int y = range.top; y <= range.bottom; ++y)
+                {
+                    for (int x = range.left; x <= range.right; ++x)
+                    {
+                        const auto cellIt = m_cells.find(getCellKey(x, y));
+                        if (cellIt != m_cells.end())
+                            m_queryResult.insert(m_queryResult.end(), cellIt->second.begin(), cellIt->second.end());
+                    }
+                }
+            }
+
+            // A widget that lies in several cells is found multiple times, but since each widget has its own z-order the
+            // duplicates end up next to each other after sorting.
+            std::sort(m_queryResult.begin(), m_queryResult.end(), [this](Widget* left, Widget* right){
+                    return m_entries.at(left).zOrder < m_entries.at(right).zOrder;
+                });
+            m_queryResult.erase(std::unique(m_queryResult.begin(), m_queryResult.end()), m_queryResult.end());
+
+            return m_queryResult;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::addToCells(Widget* widget, const Entry& entry)
+        {
+            if (entry.unbounded)
+            {
+                m_unboundedWidgets.push_back(widget);
+                return;
+            }
+
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                    m_cells[getCellKey(x, y)].push_back(widget);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::removeFromCells(Widget* widget, const Entry& entry)
+        {
+            if (entry.unbounded)
+            {
+                m_unboundedWidgets.erase(std::remove(m_unboundedWidgets.begin(), m_unboundedWidgets.end(), widget), m_unboundedWidgets.end());
+                return;
+            }
+
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                for (int x = entry.left; x <= entry.right; ++x)
+                {
+                    const auto cellIt = m_cells.find(getCellKey(x, y));
+                    if (cellIt == m_cells.end())
+                        continue;
+
+                    auto& cell = cellIt->second;
+                    cell.erase(std::remove(cell.begin(), cell.end(), widget), cell.end());
+                    if (cell.empty())
+                        m_cells.erase(cellIt);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void SpatialIndex::calculateCells(Entry& entry, FloatRect bounds, bool unbounded) const
+        {
+            const float right = bounds.left + bounds.width;
+            const float bottom = bounds.top + bounds.height;
+            if (unbounded || !std::isfinite(bounds.left) || !std::isfinite(bounds.top) || !std::isfinite(right) || !std::isfinite(bottom))
+            {
+                entry.unbounded = true;
+                return;
+            }
+
+            const float cellsLeft = std::floor(std::min(bounds.left, right) / m_cellSize);
+            const float cellsTop = std::floor(std::min(bounds.top, bottom) / m_cellSize);
+            const float cellsRight = std::floor(std::max(bounds.left, right) / m_cellSize);
+            const float cellsBottom = std::floor(std::max(bounds.top, bottom) / m_cellSize);
+
+            // Huge widgets aren't worth storing in the grid
+            if ((cellsRight - cellsLeft + 1) * (cellsBottom - cellsTop + 1) > maxCellsPerWidget)
+            {
+                entry.unbounded = true;
+                return;
+            }
+
+            entry.unbounded = false;
+            entry.left = static_cast<int>(cellsLeft);
+            entry.top = static_cast<int>(cellsTop);
+            entry.right = static_cast<int>(cellsRight);
+            entry.bottom = static_cast<int>(cellsBottom);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t SpatialIndex::getCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
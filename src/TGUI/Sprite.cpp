@@ -24,6 +24,8 @@
 
 
 #include <TGUI/Sprite.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
 
@@ -153,7 +155,7 @@ namespace tgui
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || (!m_texture.getData()->image && m_texture.getData()->alphaMask.empty()) || (m_size.x == 0) || (m_size.y == 0))
             return true;
 
         if (getRotation() != 0)
@@ -183,74 +185,74 @@ namespace tgui
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
+        const sf::Vector2u textureSize{sf::Vector2f{m_texture.getImageSize()}};
         switch (m_scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * textureSize.y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_size.y / textureSize.y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_size.y / textureSize.y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((textureSize.x - middleRect.width) * (m_size.y / textureSize.y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * textureSize.y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * textureSize.x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_size.x / textureSize.x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_size.x / textureSize.x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((textureSize.y - middleRect.height) * (m_size.x / textureSize.x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * textureSize.x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_size.x - (textureSize.x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + textureSize.x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (textureSize.x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_size.y - (textureSize.y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + textureSize.y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (textureSize.y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -277,14 +279,21 @@ namespace tgui
         FloatRect middleRect;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = aurora::makeCopied<sf::Texture>();
-
             const sf::Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            auto svgTexture = TextureManager::getSvgTexture(m_texture.getData(), svgTextureSize);
+            if (svgTexture && (svgTexture->getSize() == sf::Vector2u{0, 0}))
+            {
+                // The new texture is still being rasterized in the background, keep the last finished one around until then
+                if (m_svgTexture && (m_svgTexture->getSize() != sf::Vector2u{0, 0}))
+                    m_previousSvgTexture = m_svgTexture;
+            }
+            else
+                m_previousSvgTexture = nullptr;
+
+            m_svgTexture = std::move(svgTexture);
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -421,6 +430,34 @@ namespace tgui
             m_vertices[21] = {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        // Images in the texture atlas are located somewhere inside a larger texture
+        m_atlasTexture = m_texture.getData()->atlasTexture;
+        if (m_atlasTexture)
+        {
+            m_atlasOffset = {static_cast<float>(m_texture.getData()->atlasRect.left), static_cast<float>(m_texture.getData()->atlasRect.top)};
+            for (auto& vertex : m_vertices)
+                vertex.texCoords += m_atlasOffset;
+        }
+        else
+            m_atlasOffset = {0, 0};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Sprite::updateAtlasTexCoords() const
+    {
+        const auto& data = m_texture.getData();
+        sf::Vector2f atlasOffset;
+        if (data->atlasTexture)
+            atlasOffset = {static_cast<float>(data->atlasRect.left), static_cast<float>(data->atlasRect.top)};
+
+        for (auto& vertex : m_vertices)
+            vertex.texCoords += atlasOffset - m_atlasOffset;
+
+        // Releasing the old page allows its memory to be freed once no other sprite uses it
+        m_atlasTexture = data->atlasTexture;
+        m_atlasOffset = atlasOffset;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,13 +489,48 @@ namespace tgui
             clipping = std::make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
 #endif
 
+        states.shader = m_shader;
         if (m_texture.getData()->svgImage)
+        {
+            if (!m_svgTexture)
+                return;
+
+            if (m_svgTexture->getSize() == sf::Vector2u{0, 0})
+            {
+                // Nothing can be drawn until the first rasterization of the image has finished
+                if (!m_previousSvgTexture || (m_size.x <= 0) || (m_size.y <= 0))
+                    return;
+
+                // Stretch the old image to the new size by changing the texture coordinates
+                const sf::Vector2u previousSize = m_previousSvgTexture->getSize();
+                std::vector<sf::Vertex> vertices = m_vertices;
+                for (auto& vertex : vertices)
+                {
+                    vertex.texCoords.x = vertex.texCoords.x * previousSize.x / m_size.x;
+                    vertex.texCoords.y = vertex.texCoords.y * previousSize.y / m_size.y;
+                }
+
+                states.texture = m_previousSvgTexture.get();
+                DrawBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                return;
+            }
+
+            m_previousSvgTexture = nullptr;
             states.texture = m_svgTexture.get();
+        }
         else
-            states.texture = &m_texture.getData()->texture;
+        {
+            // The texture manager can move the image when repacking an atlas page or when giving it its own texture
+            if (m_atlasTexture != m_texture.getData()->atlasTexture)
+                updateAtlasTexCoords();
 
-        states.shader = m_shader;
-        target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            if (m_atlasTexture)
+                states.texture = m_atlasTexture.get();
+            else
+                states.texture = &m_texture.getData()->texture;
+        }
+
+        DrawBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +104,29 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::uint8_t> SvgImage::rasterizeToPixels(sf::Vector2u size) const
+    {
+        if (!m_svg || (size.x == 0) || (size.y == 0))
+            return {};
+
+        // The rasterizer contains the scratch memory, so each call needs its own to allow calls from multiple threads.
+        // The svg itself is only read while rasterizing.
+        NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+        if (!rasterizer)
+            return {};
+
+        const float scaleX = size.x / static_cast<float>(m_svg->width);
+        const float scaleY = size.y / static_cast<float>(m_svg->height);
+
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(size.x) * size.y * 4);
+        nsvgRasterizeFull(rasterizer, m_svg, 0, 0, static_cast<double>(scaleX), static_cast<double>(scaleY), pixels.data(), size.x, size.y, size.x * 4);
+
+        nsvgDeleteRasterizer(rasterizer);
+        return pixels;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,8 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/GlyphMetricsCache.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
 
@@ -34,6 +36,50 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Adds an underline or strike through line, in the same way as sf::Text does it
+        void addTextLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, sf::Color color, float offset, float thickness)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+
+            vertices.emplace_back(sf::Vector2f{0, top}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+            vertices.emplace_back(sf::Vector2f{lineLength, bottom}, color, sf::Vector2f{1, 1});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the quad of a single character, in the same way as sf::Text does it
+        void addGlyphQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1.0;
+
+            const float left   = glyph.bounds.left - padding;
+            const float top    = glyph.bounds.top - padding;
+            const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top  + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top  + glyph.textureRect.height) + padding;
+
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * top,    position.y + top},    color, sf::Vector2f{u1, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + left  - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top,    position.y + top},    color, sf::Vector2f{u2, v1});
+            vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u2, v2});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Text::getSize() const
     {
         return m_size;
@@ -43,6 +89,7 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
+        m_verticesNeedUpdate = true;
         m_text.setString(string);
         recalculateSize();
     }
@@ -58,6 +105,7 @@ namespace tgui
 
     void Text::setCharacterSize(unsigned int size)
     {
+        m_verticesNeedUpdate = true;
         m_text.setCharacterSize(size);
         recalculateSize();
     }
@@ -73,6 +121,7 @@ namespace tgui
 
     void Text::setColor(Color color)
     {
+        m_verticesNeedUpdate = true;
         m_color = color;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
@@ -93,6 +142,7 @@ namespace tgui
 
     void Text::setOpacity(float opacity)
     {
+        m_verticesNeedUpdate = true;
         m_opacity = opacity;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
@@ -113,6 +163,7 @@ namespace tgui
 
     void Text::setFont(Font font)
     {
+        m_verticesNeedUpdate = true;
         m_font = font;
 
         if (font)
@@ -151,6 +202,7 @@ namespace tgui
     {
         if (style != m_text.getStyle())
         {
+            m_verticesNeedUpdate = true;
             m_text.setStyle(style);
             recalculateSize();
         }
@@ -182,7 +234,20 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // When batching, the glyphs are passed as triangles so that they can be merged with the geometry of other widgets
+        if (m_font && DrawBatch::isBatching(target))
+        {
+            if (m_verticesNeedUpdate)
+                updateVertices();
+
+            states.texture = &m_font.getFont()->getTexture(m_text.getCharacterSize());
+            DrawBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states, true);
+            return;
+        }
+    #endif
+
+        DrawBatch::draw(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,20 +266,18 @@ namespace tgui
         std::uint32_t prevChar = 0;
         const sf::String& string = m_text.getString();
         const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        auto& glyphMetrics = priv::GlyphMetricsCache::get(m_font, m_text.getCharacterSize(), bold);
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
+            const float kerning = glyphMetrics.getKerning(prevChar, string[i]);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
                 width = 0;
                 lines++;
             }
-            else if (string[i] == '\t')
-                width += (static_cast<float>(m_font.getGlyph(' ', textSize, bold).advance) * 4) + kerning;
-            else
-                width += static_cast<float>(m_font.getGlyph(string[i], textSize, bold).advance) + kerning;
+            else // The advance of a tab is the width of 4 spaces
+                width += glyphMetrics.getAdvance(string[i]) + kerning;
 
             prevChar = string[i];
         }
@@ -226,6 +289,91 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Text::updateVertices() const
+    {
+        m_verticesNeedUpdate = false;
+        m_vertices.clear();
+
+        const std::shared_ptr<sf::Font> font = m_font.getFont();
+        if (!font)
+            return;
+
+        const sf::String& string = m_text.getString();
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const sf::Uint32 style = m_text.getStyle();
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const sf::Color color = m_text.getFillColor();
+    #else
+        const sf::Color color = m_text.getColor();
+    #endif
+
+        const bool isBold = (style & sf::Text::Bold) != 0;
+        const bool isUnderlined = (style & sf::Text::Underlined) != 0;
+        const bool isStrikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f;
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float underlineThickness = font->getUnderlineThickness(characterSize);
+
+        const sf::FloatRect xBounds = font->getGlyph(U'x', characterSize, isBold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+
+        const float whitespaceWidth = font->getGlyph(U' ', characterSize, isBold).advance;
+        const float lineSpacing = font->getLineSpacing(characterSize);
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            if (curChar == U'\r')
+                continue;
+
+            x += font->getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == U'\n') && (prevChar != U'\n'))
+            {
+                if (isUnderlined)
+                    addTextLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+                if (isStrikeThrough)
+                    addTextLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == U' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == U'\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == U'\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, isBold);
+            addGlyphQuad(m_vertices, {x, y}, color, glyph, italicShear);
+            x += glyph.advance;
+        }
+
+        if (x > 0)
+        {
+            if (isUnderlined)
+                addTextLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+            if (isStrikeThrough)
+                addTextLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     float Text::getExtraHorizontalPadding(const Text& text)
     {
@@ -315,28 +463,8 @@ namespace tgui
         if (font == nullptr)
             return 0.0f;
 
-        bool bold = (textStyle & sf::Text::Bold) != 0;
-
-        float width = 0.0f;
-        std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < text.getSize(); ++i)
-        {
-            float charWidth;
-            const std::uint32_t curChar = text[i];
-            if (curChar == '\n')
-                break;
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
-
-            const float kerning = font.getKerning(prevChar, curChar, characterSize);
-
-            width = width + charWidth + kerning;
-            prevChar = curChar;
-        }
-
-        return width;
+        const bool bold = (textStyle & sf::Text::Bold) != 0;
+        return priv::GlyphMetricsCache::get(font, characterSize, bold).getLineWidth(text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,17 +514,7 @@ namespace tgui
             return 0;
 
         const bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        const float lineSpacing = font.getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        return priv::GlyphMetricsCache::get(font, characterSize, bold).getExtraVerticalSpace();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,6 +524,8 @@ namespace tgui
         if (font == nullptr)
             return "";
 
+        auto& glyphMetrics = priv::GlyphMetricsCache::get(font, textSize, bold);
+
         sf::String result;
         std::size_t index = 0;
         while (index < text.getSize())
@@ -417,19 +537,15 @@ namespace tgui
             std::uint32_t prevChar = 0;
             for (std::size_t i = index; i < text.getSize(); ++i)
             {
-                float charWidth;
                 const std::uint32_t curChar = text[i];
                 if (curChar == '\n')
                 {
                     index++;
                     break;
                 }
-                else if (curChar == '\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize);
+                const float charWidth = glyphMetrics.getAdvance(curChar);
+                const float kerning = glyphMetrics.getKerning(prevChar, curChar);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     width += kerning + charWidth;
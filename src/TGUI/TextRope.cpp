@@ -0,0 +1,504 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextRope.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        struct TextRopeNode
+        {
+            std::vector<sf::Uint32> chunk;
+            std::size_t size = 0; // Amount of characters in this node and its children
+            std::uint32_t priority = 0;
+            std::unique_ptr<TextRopeNode> left;
+            std::unique_ptr<TextRopeNode> right;
+        };
+
+        namespace
+        {
+            // A chunk can grow up to this size by inserting characters in it. New chunks are only filled halfway so that
+            // characters can still be inserted in them without having to split the tree.
+            const std::size_t maxRopeChunkSize = 512;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            std::size_t getRopeSize(const std::unique_ptr<TextRopeNode>& node)
+            {
+                return node ? node->size : 0;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            void updateRopeSize(TextRopeNode& node)
+            {
+                node.size = getRopeSize(node.left) + node.chunk.size() + getRopeSize(node.right);
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // The priorities only have to be random enough to keep the tree balanced, so a simple xorshift generator is used
+            std::uint32_t generateRopePriority(std::uint32_t& randomState)
+            {
+                randomState ^= randomState << 13;
+                randomState ^= randomState >> 17;
+                randomState ^= randomState << 5;
+                return randomState;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            std::unique_ptr<TextRopeNode> mergeRopes(std::unique_ptr<TextRopeNode> left, std::unique_ptr<TextRopeNode> right)
+            {
+                if (!left)
+                    return right;
+                if (!right)
+                    return left;
+
+                if (left->priority >= right->priority)
+                {
+                    left->right = mergeRopes(std::move(left->right), std::move(right));
+                    updateRopeSize(*left);
+                    return left;
+                }
+                else
+                {
+                    right->left = mergeRopes(std::move(left), std::move(right->left));
+                    updateRopeSize(*right);
+                    return right;
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Creates a tree from the given characters, with chunks that are only filled halfway
+            std::unique_ptr<TextRopeNode> buildRope(const sf::Uint32* begin, const sf::Uint32* end, std::uint32_t& randomState)
+            {
+                std::unique_ptr<TextRopeNode> root;
+                while (begin != end)
+                {
+                    const std::size_t chunkSize = std::min<std::size_t>(end - begin, maxRopeChunkSize / 2);
+
+                    auto node = std::make_unique<TextRopeNode>();
+                    node->chunk.assign(begin, begin + chunkSize);
+                    node->priority = generateRopePriority(randomState);
+                    updateRopeSize(*node);
+
+                    root = mergeRopes(std::move(root), std::move(node));
+                    begin += chunkSize;
+                }
+
+                return root;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Splits the tree so that the first tree contains the characters in front of the position and the second tree
+            // contains the remaining characters. A chunk that contains the position is split in two chunks.
+            void splitRope(std::unique_ptr<TextRopeNode> node, std::size_t position,
+                           std::unique_ptr<TextRopeNode>& left, std::unique_ptr<TextRopeNode>& right, std::uint32_t& randomState)
+            {
+                if (!node)
+                {
+                    left = nullptr;
+                    right = nullptr;
+                    return;
+                }
+
+                const std::size_t chunkStart = getRopeSize(node->left);
+                const std::size_t chunkEnd = chunkStart + node->chunk.size();
+                if (position <= chunkStart)
+                {
+                    std::unique_ptr<TextRopeNode> leftChild = std::move(node->left);
+                    splitRope(std::move(leftChild), position, left, node->left, randomState);
+                    updateRopeSize(*node);
+                    right = std::move(node);
+                }
+                else if (position >= chunkEnd)
+                {
+                    std::unique_ptr<TextRopeNode> rightChild = std::move(node->right);
+                    splitRope(std::move(rightChild), position - chunkEnd, node->right, right, randomState);
+                    updateRopeSize(*node);
+                    left = std::move(node);
+                }
+                else // The position lies inside the chunk of this node
+                {
+                    auto secondHalf = std::make_unique<TextRopeNode>();
+                    secondHalf->chunk.assign(node->chunk.begin() + (position - chunkStart), node->chunk.end());
+                    secondHalf->priority = generateRopePriority(randomState);
+                    updateRopeSize(*secondHalf);
+
+                    node->chunk.erase(node->chunk.begin() + (position - chunkStart), node->chunk.end());
+
+                    right = mergeRopes(std::move(secondHalf), std::move(node->right));
+                    updateRopeSize(*node);
+                    left = std::move(node);
+                }
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Inserts the characters in the chunk that contains the position, if that chunk has enough room for them
+            bool insertInRopeChunk(TextRopeNode& node, std::size_t position, const sf::String& text)
+            {
+                const std::size_t chunkStart = getRopeSize(node.left);
+                const std::size_t chunkEnd = chunkStart + node.chunk.size();
+
+                bool inserted;
+                if (position < chunkStart)
+                    inserted = insertInRopeChunk(*node.left, position, text);
+                else if (position > chunkEnd)
+                    inserted = insertInRopeChunk(*node.right, position - chunkEnd, text);
+                else if (node.chunk.size() + text.getSize() <= maxRopeChunkSize)
+                {
+                    node.chunk.insert(node.chunk.begin() + (position - chunkStart), text.begin(), text.end());
+                    inserted = true;
+                }
+                else
+                    inserted = false;
+
+                if (inserted)
+                    node.size += text.getSize();
+
+                return inserted;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Erases the characters when they are all part of the same chunk and the chunk doesn't become empty
+            bool eraseInRopeChunk(TextRopeNode& node, std::size_t position, std::size_t count)
+            {
+                const std::size_t chunkStart = getRopeSize(node.left);
+                const std::size_t chunkEnd = chunkStart + node.chunk.size();
+
+                bool erased;
+                if (position < chunkStart)
+                    erased = eraseInRopeChunk(*node.left, position, count);
+                else if (position >= chunkEnd)
+                    erased = eraseInRopeChunk(*node.right, position - chunkEnd, count);
+                else if ((position + count <= chunkEnd) && (count < node.chunk.size()))
+                {
+                    const auto first = node.chunk.begin() + (position - chunkStart);
+                    node.chunk.erase(first, first + count);
+                    erased = true;
+                }
+                else
+                    erased = false;
+
+                if (erased)
+                    node.size -= count;
+
+                return erased;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            std::unique_ptr<TextRopeNode> copyRope(const TextRopeNode* node)
+            {
+                if (!node)
+                    return nullptr;
+
+                auto newNode = std::make_unique<TextRopeNode>();
+                newNode->chunk = node->chunk;
+                newNode->size = node->size;
+                newNode->priority = node->priority;
+                newNode->left = copyRope(node->left.get());
+                newNode->right = copyRope(node->right.get());
+                return newNode;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Calls the function for every part of a chunk that lies between first and last, from front to back, until the
+            // function returns false. The function is given a pointer to the characters, their amount and the index of the first one.
+            template <typename Function>
+            bool visitRopeChunks(const TextRopeNode* node, std::size_t nodeStart, std::size_t first, std::size_t last, Function& function)
+            {
+                if (!node)
+                    return true;
+
+                const std::size_t chunkStart = nodeStart + getRopeSize(node->left);
+                const std::size_t chunkEnd = chunkStart + node->chunk.size();
+
+                if ((first < chunkStart) && !visitRopeChunks(node->left.get(), nodeStart, first, last, function))
+                    return false;
+
+                if ((first < chunkEnd) && (last > chunkStart))
+                {
+                    const std::size_t from = std::max(first, chunkStart);
+                    const std::size_t to = std::min(last, chunkEnd);
+                    if (!function(node->chunk.data() + (from - chunkStart), to - from, from))
+                        return false;
+                }
+
+                if (last > chunkEnd)
+                    return visitRopeChunks(node->right.get(), chunkEnd, first, last, function);
+                else
+                    return true;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+            // Same as visitRopeChunks, but the chunks are visited from back to front
+            template <typename Function>
+            bool visitRopeChunksBackwards(const TextRopeNode* node, std::size_t nodeStart, std::size_t first, std::size_t last, Function& function)
+            {
+                if (!node)
+                    return true;
+
+                const std::size_t chunkStart = nodeStart + getRopeSize(node->left);
+                const std::size_t chunkEnd = chunkStart + node->chunk.size();
+
+                if ((last > chunkEnd) && !visitRopeChunksBackwards(node->right.get(), chunkEnd, first, last, function))
+                    return false;
+
+                if ((first < chunkEnd) && (last > chunkStart))
+                {
+                    const std::size_t from = std::max(first, chunkStart);
+                    const std::size_t to = std::min(last, chunkEnd);
+                    if (!function(node->chunk.data() + (from - chunkStart), to - from, from))
+                        return false;
+                }
+
+                if (first < chunkStart)
+                    return visitRopeChunksBackwards(node->left.get(), nodeStart, first, last, function);
+                else
+                    return true;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope::TextRope() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope::TextRope(const sf::String& text) :
+            m_root{buildRope(text.getData(), text.getData() + text.getSize(), m_randomState)}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope::TextRope(const TextRope& other) :
+            m_root       {copyRope(other.m_root.get())},
+            m_randomState{other.m_randomState}
+        {
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope::TextRope(TextRope&& other) noexcept = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope::~TextRope() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope& TextRope::operator=(const TextRope& other)
+        {
+            if (this != &other)
+            {
+                m_root = copyRope(other.m_root.get());
+                m_randomState = other.m_randomState;
+            }
+
+            return *this;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        TextRope& TextRope::operator=(TextRope&& other) noexcept = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextRope::getSize() const
+        {
+            return getRopeSize(m_root);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool TextRope::isEmpty() const
+        {
+            return getSize() == 0;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint32_t TextRope::operator[](std::size_t index) const
+        {
+            assert(index < getSize());
+
+            const TextRopeNode* node = m_root.get();
+            while (true)
+            {
+                const std::size_t chunkStart = getRopeSize(node->left);
+                if (index < chunkStart)
+                    node = node->left.get();
+                else if (index < chunkStart + node->chunk.size())
+                    return node->chunk[index - chunkStart];
+                else
+                {
+                    index -= chunkStart + node->chunk.size();
+                    node = node->right.get();
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextRope::insert(std::size_t position, const sf::String& text)
+        {
+            if (text.isEmpty())
+                return;
+
+            if (position > getSize())
+                position = getSize();
+
+            // Try to add the characters to an existing chunk before creating new ones
+            if (m_root && insertInRopeChunk(*m_root, position, text))
+                return;
+
+            std::unique_ptr<TextRopeNode> left;
+            std::unique_ptr<TextRopeNode> right;
+            splitRope(std::move(m_root), position, left, right, m_randomState);
+
+            auto middle = buildRope(text.getData(), text.getData() + text.getSize(), m_randomState);
+            m_root = mergeRopes(mergeRopes(std::move(left), std::move(middle)), std::move(right));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextRope::erase(std::size_t position, std::size_t count)
+        {
+            const std::size_t size = getSize();
+            if (position >= size)
+                return;
+
+            if (count > size - position)
+                count = size - position;
+
+            if (count == 0)
+                return;
+
+            if (eraseInRopeChunk(*m_root, position, count))
+                return;
+
+            std::unique_ptr<TextRopeNode> left;
+            std::unique_ptr<TextRopeNode> middle;
+            std::unique_ptr<TextRopeNode> right;
+            splitRope(std::move(m_root), position, left, right, m_randomState);
+            splitRope(std::move(right), count, middle, right, m_randomState);
+            m_root = mergeRopes(std::move(left), std::move(right));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void TextRope::clear()
+        {
+            m_root = nullptr;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String TextRope::substring(std::size_t position, std::size_t count) const
+        {
+            const std::size_t size = getSize();
+            if (position >= size)
+                return "";
+
+            if (count > size - position)
+                count = size - position;
+
+            std::vector<sf::Uint32> characters;
+            characters.reserve(count);
+            auto appendCharacters = [&characters](const sf::Uint32* data, std::size_t length, std::size_t){
+                characters.insert(characters.end(), data, data + length);
+                return true;
+            };
+            visitRopeChunks(m_root.get(), 0, position, position + count, appendCharacters);
+
+            return sf::String::fromUtf32(characters.begin(), characters.end());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::String TextRope::toString() const
+        {
+            return substring(0);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextRope::find(std::uint32_t character, std::size_t start) const
+        {
+            std::size_t result = sf::String::InvalidPos;
+            auto findCharacter = [character,&result](const sf::Uint32* data, std::size_t length, std::size_t index){
+                const sf::Uint32* it = std::find(data, data + length, character);
+                if (it == data + length)
+                    return true;
+
+                result = index + static_cast<std::size_t>(it - data);
+                return false;
+            };
+            visitRopeChunks(m_root.get(), 0, start, getSize(), findCharacter);
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t TextRope::findLast(std::uint32_t character, std::size_t end) const
+        {
+            std::size_t result = sf::String::InvalidPos;
+            auto findCharacter = [character,&result](const sf::Uint32* data, std::size_t length, std::size_t index){
+                for (std::size_t i = length; i > 0; --i)
+                {
+                    if (data[i-1] == character)
+                    {
+                        result = index + i - 1;
+                        return false;
+                    }
+                }
+
+                return true;
+            };
+            visitRopeChunksBackwards(m_root.get(), 0, 0, std::min(end, getSize()), findCharacter);
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +227,8 @@ namespace tgui
 
         if (m_data->svgImage)
             return m_data->svgImage->getSize();
+        else if (m_data->atlasTexture)
+            return {static_cast<float>(m_data->atlasRect.width), static_cast<float>(m_data->atlasRect.height)};
         else
             return {sf::Vector2f{m_data->texture.getSize()}};
     }
@@ -235,15 +237,23 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data)
+            return;
+
+        // All images in an atlas page share the same filter, so a smooth image needs its own texture
+        if (smooth && m_data->atlasTexture)
+            TextureManager::removeFromAtlas(m_data);
+
+        m_data->texture.setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isSmooth() const
     {
-        if (m_data)
+        if (m_data && m_data->atlasTexture)
+            return m_data->atlasTexture->isSmooth();
+        else if (m_data)
             return m_data->texture.isSmooth();
         else
             return false;
@@ -300,13 +310,15 @@ namespace tgui
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
-        if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
-            return true;
+        if (m_data->image)
+            return (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0);
+        else if (!m_data->alphaMask.empty())
+            return !m_data->alphaMask[pixel.y * static_cast<std::size_t>(getImageSize().x) + pixel.x];
         else
             return false;
     }
@@ -387,7 +399,7 @@ namespace tgui
             if (m_data->svgImage)
                 m_middleRect = {0, 0, static_cast<int>(m_data->svgImage->getSize().x), static_cast<int>(m_data->svgImage->getSize().y)};
             else
-                m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+                m_middleRect = {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
         }
         else
             m_middleRect = middleRect;
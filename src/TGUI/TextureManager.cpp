@@ -26,58 +26,141 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/WorkerPool.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <chrono>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_map<TextureManager::ImageKey, std::shared_ptr<TextureData>, TextureManager::ImageKeyHash> TextureManager::m_imageMap;
+    bool TextureManager::m_keepImagesAfterUpload = true;
+    std::list<TextureManager::SvgCacheEntry> TextureManager::m_svgCache;
+    std::map<TextureManager::SvgCacheKey, std::list<TextureManager::SvgCacheEntry>::iterator> TextureManager::m_svgCacheIndex;
+    std::size_t TextureManager::m_svgCacheMemoryUsage = 0;
+    std::size_t TextureManager::m_svgCacheLimit = 16 * 1024 * 1024;
+    std::size_t TextureManager::m_svgCacheHitCount = 0;
+    std::size_t TextureManager::m_svgCacheMissCount = 0;
+    bool TextureManager::m_asyncSvgRasterization = false;
+    std::function<void(sf::Vector2u, sf::Time, sf::Time)> TextureManager::m_svgRasterizationCallback;
+    CommandQueue TextureManager::m_uploadQueue;
+    std::unique_ptr<priv::WorkerPool> TextureManager::m_workerPool; // Destroyed before the upload queue that its jobs use
+    std::map<sf::String, std::shared_ptr<const sf::Image>> TextureManager::m_preloadedImages;
+    std::vector<std::shared_ptr<TextureData>> TextureManager::m_preloadedTextures;
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasPageSize = 2048;
+    std::vector<TextureManager::AtlasPage> TextureManager::m_atlasPages;
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
+    namespace
     {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        sf::Time convertToSfmlTime(std::chrono::steady_clock::duration duration)
+        {
+            return sf::microseconds(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+        }
+
+        bool isSvgFilename(const sf::String& filename)
+        {
+            return (filename.getSize() > 4) && (toLower(filename.substring(filename.getSize() - 4, 4)) == ".svg");
+        }
+
+        // Returns the part of the image that is used, sf::Texture::loadFromImage clips the part rect in the same way
+        sf::IntRect getClippedPartRect(const sf::Image& image, sf::IntRect rect)
         {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            const sf::Vector2u imageSize = image.getSize();
+            if (rect == sf::IntRect{})
+                return {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+
+            rect.left = std::max(rect.left, 0);
+            rect.top = std::max(rect.top, 0);
+            rect.width = std::min(rect.width, static_cast<int>(imageSize.x) - rect.left);
+            rect.height = std::min(rect.height, static_cast<int>(imageSize.y) - rect.top);
+            return rect;
+        }
+
+        std::vector<bool> createAlphaMask(const sf::Image& image, const sf::IntRect& rect)
+        {
+            if ((rect.width <= 0) || (rect.height <= 0))
+                return {};
+
+            const sf::Uint8* pixels = image.getPixelsPtr();
+            const std::size_t imageWidth = image.getSize().x;
+
+            std::vector<bool> mask(static_cast<std::size_t>(rect.width) * rect.height);
+            for (int y = 0; y < rect.height; ++y)
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
-                {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
+                const sf::Uint8* alpha = pixels + ((rect.top + y) * imageWidth + rect.left) * 4 + 3;
+                for (int x = 0; x < rect.width; ++x)
+                    mask[y * rect.width + x] = (alpha[x * 4] != 0);
+            }
 
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return dataIt->data;
-                }
+            return mask;
+        }
+
+        // Copies parts of a texture to the given locations in a new texture. The pixels stay on the graphics card when
+        // framebuffer objects are supported, otherwise only the new texture is downloaded to copy it.
+        bool copyTextureRegions(const sf::Texture& source, const std::vector<std::pair<sf::IntRect, sf::Vector2u>>& regions,
+                                sf::Vector2u targetSize, sf::Texture& target)
+        {
+            sf::RenderTexture renderTexture;
+            if (!renderTexture.create(targetSize.x, targetSize.y))
+                return false;
+
+            renderTexture.clear(sf::Color::Transparent);
+            for (const auto& region : regions)
+            {
+                sf::Sprite sprite{source, region.first};
+                sprite.setPosition(static_cast<float>(region.second.x), static_cast<float>(region.second.y));
+                renderTexture.draw(sprite, sf::BlendNone);
             }
+
+            renderTexture.display();
+            target = renderTexture.getTexture();
+            return true;
         }
-        else // The image doesn't exist yet
+
+        // Prepends the resource path the same way as Texture::load does
+        sf::String getTextureFilename(const sf::String& id)
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+#ifdef SFML_SYSTEM_WINDOWS
+            if ((id[0] != '/') && (id[0] != '\\') && ((id.getSize() <= 1) || (id[1] != ':')))
+#else
+            if (id[0] != '/')
+#endif
+                return getResourcePath() + id;
+            else
+                return id;
         }
+    }
 
-        // Add new data to the list
-        TextureDataHolder dataHolder;
-        dataHolder.filename = filename;
-        dataHolder.users = 1;
-        dataHolder.data = std::make_shared<TextureData>();
-        dataHolder.data->rect = partRect;
-        imageIt->second.push_back(std::move(dataHolder));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const sf::String& filename, const sf::IntRect& partRect)
+    {
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
+        // Look if we already had this image
+        const auto insertResult = m_imageMap.insert({ImageKey{filename, partRect}, nullptr});
+        const auto imageIt = insertResult.first;
+        if (!insertResult.second)
+        {
+            // The texture is now used at multiple places
+            ++imageIt->second->users;
+            return imageIt->second;
+        }
+
+        auto data = std::make_shared<TextureData>();
+        data->filename = filename;
+        data->rect = partRect;
+        data->users = 1;
+        imageIt->second = data;
+
         // Load the image
-        auto data = imageIt->second.back().data;
-        if ((filename.getSize() > 4) && (toLower(filename.substring(filename.getSize() - 4, 4)) == ".svg"))
+        if (isSvgFilename(filename))
         {
             data->svgImage = std::make_unique<SvgImage>(filename);
             if (data->svgImage->isSet())
@@ -85,12 +168,20 @@ namespace tgui
         }
         else // Not an svg
         {
-            data->image = texture.getImageLoader()(filename);
+            // Reuse the image when it was already decoded in the background
+            const auto preloadedImageIt = m_preloadedImages.find(filename);
+            if (preloadedImageIt != m_preloadedImages.end())
+                data->image = std::make_unique<sf::Image>(*preloadedImageIt->second);
+            else
+                data->image = texture.getImageLoader()(filename);
+
             if (data->image != nullptr)
             {
                 // Create a texture from the image
                 bool loadFromImageSuccess;
-                if (partRect == sf::IntRect{})
+                if (m_atlasEnabled && addToAtlas(*data))
+                    loadFromImageSuccess = true;
+                else if (partRect == sf::IntRect{})
                     loadFromImageSuccess = data->texture.loadFromImage(*data->image);
                 else
                 {
@@ -101,16 +192,21 @@ namespace tgui
                 }
 
                 if (loadFromImageSuccess)
+                {
+                    if (!m_keepImagesAfterUpload)
+                    {
+                        data->alphaMask = createAlphaMask(*data->image, getClippedPartRect(*data->image, partRect));
+                        data->image = nullptr;
+                    }
+
                     return data;
+                }
             }
         }
 
         // The image could not be loaded
-        if (imageIt->second.size() > 1)
-            imageIt->second.pop_back();
-        else
-            m_imageMap.erase(imageIt);
-
+        data->users = 0;
+        m_imageMap.erase(imageIt);
         return nullptr;
     }
 
@@ -118,50 +214,603 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        // Texture data that wasn't created by us (or that was already removed) has no users
+        if (!textureDataToCopy || (textureDataToCopy->users == 0))
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++textureDataToCopy->users;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        if (!textureDataToRemove || (textureDataToRemove->users == 0))
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // The image is only removed from memory when this was the last place where the texture was used
+        if (--textureDataToRemove->users > 0)
+            return;
+
+        // A new svg could later be loaded at the same address, so its rasterizations can't be kept
+        if (textureDataToRemove->svgImage)
+            removeSvgFromCache(textureDataToRemove->svgImage.get());
+
+        m_imageMap.erase(ImageKey{textureDataToRemove->filename, textureDataToRemove->rect});
+
+        // Sprites keep their own reference to the atlas page for as long as they still need it
+        if (textureDataToRemove->atlasTexture)
+        {
+            releaseAtlasSpace(*textureDataToRemove);
+            removeUnusedAtlasPages();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Texture> TextureManager::getSvgTexture(const std::shared_ptr<TextureData>& textureData, sf::Vector2u size)
+    {
+        if (!textureData || !textureData->svgImage || (size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        const SvgImage* svgImage = textureData->svgImage.get();
+        const auto indexIt = m_svgCacheIndex.find(SvgCacheKey{svgImage, size.x, size.y});
+        if (indexIt != m_svgCacheIndex.end())
         {
-            for (auto& data : dataHolder.second)
+            // Move the texture to the front of the list as it is now the most recently used one
+            m_svgCache.splice(m_svgCache.begin(), m_svgCache, indexIt->second);
+            ++m_svgCacheHitCount;
+            return indexIt->second->texture;
+        }
+
+        ++m_svgCacheMissCount;
+
+        const auto requestTime = std::chrono::steady_clock::now();
+        auto texture = std::make_shared<sf::Texture>();
+        if (m_asyncSvgRasterization)
+        {
+            // The texture remains empty until the pixels are uploaded on the gui thread. The job keeps the svg image alive,
+            // in case the texture data is destroyed before the rasterization finished.
+            std::shared_ptr<const SvgImage> sharedSvgImage = textureData->svgImage;
+            getWorkerPool().post([sharedSvgImage, texture, size, requestTime]() mutable
+                {
+                    const auto startTime = std::chrono::steady_clock::now();
+                    std::vector<std::uint8_t> pixels = sharedSvgImage->rasterizeToPixels(size);
+                    const sf::Time rasterizationTime = convertToSfmlTime(std::chrono::steady_clock::now() - startTime);
+
+                    // The texture is moved into the command so that it is never destroyed on a worker thread
+                    m_uploadQueue.post([texture=std::move(texture), pixels=std::move(pixels), size, requestTime, rasterizationTime]
+                        {
+                            if (!pixels.empty() && texture->create(size.x, size.y))
+                                texture->update(pixels.data());
+
+                            if (m_svgRasterizationCallback)
+                                m_svgRasterizationCallback(size, rasterizationTime, convertToSfmlTime(std::chrono::steady_clock::now() - requestTime));
+                        });
+                });
+        }
+        else
+        {
+            textureData->svgImage->rasterize(*texture, size);
+            if (texture->getSize() != size)
+                return nullptr;
+
+            if (m_svgRasterizationCallback)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                const sf::Time rasterizationTime = convertToSfmlTime(std::chrono::steady_clock::now() - requestTime);
+                m_svgRasterizationCallback(size, rasterizationTime, rasterizationTime);
+            }
+        }
+
+        m_svgCache.push_front({svgImage, size, texture});
+        m_svgCacheIndex[SvgCacheKey{svgImage, size.x, size.y}] = m_svgCache.begin();
+        m_svgCacheMemoryUsage += static_cast<std::size_t>(size.x) * size.y * 4;
+
+        shrinkSvgCache();
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setSvgCacheLimit(std::size_t bytes)
+    {
+        m_svgCacheLimit = bytes;
+        shrinkSvgCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getSvgCacheLimit()
+    {
+        return m_svgCacheLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getSvgCacheMemoryUsage()
+    {
+        return m_svgCacheMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getSvgCacheHitCount()
+    {
+        return m_svgCacheHitCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getSvgCacheMissCount()
+    {
+        return m_svgCacheMissCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::clearSvgCache()
+    {
+        m_svgCacheIndex.clear();
+        m_svgCache.clear();
+        m_svgCacheMemoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncSvgRasterizationEnabled(bool enabled)
+    {
+        // Images that are still being rasterized when disabling the option are uploaded like the others
+        m_asyncSvgRasterization = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncSvgRasterizationEnabled()
+    {
+        return m_asyncSvgRasterization;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::processPendingUploads(bool waitForBackgroundJobs)
+    {
+        if (waitForBackgroundJobs && m_workerPool)
+            m_workerPool->waitUntilIdle();
+
+        return m_uploadQueue.execute();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::preloadTexturesAsync(const std::vector<sf::String>& ids, std::function<void(std::size_t loadedCount, std::size_t totalCount)> progressCallback)
+    {
+        // The counter is only accessed from the upload commands, which are all executed on the gui thread
+        auto loadedCount = std::make_shared<std::size_t>(0);
+        const std::size_t totalCount = ids.size();
+        const Texture::ImageLoaderFunc imageLoader = Texture::getImageLoader();
+        for (const auto& id : ids)
+        {
+            const sf::String filename = id.isEmpty() ? sf::String{} : getTextureFilename(id);
+            getWorkerPool().post([id, filename, imageLoader, loadedCount, totalCount, progressCallback]
                 {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
+                    // Svg images are parsed when the texture is created, only other images can be decoded in advance
+                    std::shared_ptr<const sf::Image> image;
+                    if (!filename.isEmpty() && !isSvgFilename(filename))
+                        image = imageLoader(filename);
+
+                    m_uploadQueue.post([id, filename, image, loadedCount, totalCount, progressCallback]
+                        {
+                            // The image is only uploaded when a texture is created from it, as widgets might only use a part of it
+                            if (image)
+                                m_preloadedImages[filename] = image;
+                            else if (!filename.isEmpty() && isSvgFilename(filename))
+                            {
+                                try
+                                {
+                                    Texture texture{id};
+                                    copyTexture(texture.getData());
+                                    m_preloadedTextures.push_back(texture.getData());
+                                }
+                                catch (const Exception&)
+                                {
+                                    // The image couldn't be loaded, widgets that use it will throw the exception again
+                                }
+                            }
+
+                            ++*loadedCount;
+                            if (progressCallback)
+                                progressCallback(*loadedCount, totalCount);
+                        });
+                });
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releasePreloadedTextures()
+    {
+        const auto textures = std::move(m_preloadedTextures);
+        m_preloadedTextures.clear();
+        for (const auto& data : textures)
+            removeTexture(data);
+
+        m_preloadedImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setSvgRasterizationCallback(std::function<void(sf::Vector2u size, sf::Time rasterizationTime, sf::Time latency)> callback)
+    {
+        m_svgRasterizationCallback = std::move(callback);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    priv::WorkerPool& TextureManager::getWorkerPool()
+    {
+        if (!m_workerPool)
+            m_workerPool = std::make_unique<priv::WorkerPool>();
+
+        return *m_workerPool;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setKeepImagesAfterUpload(bool keep)
+    {
+        m_keepImagesAfterUpload = keep;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getKeepImagesAfterUpload()
+    {
+        return m_keepImagesAfterUpload;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getImageMemoryUsage()
+    {
+        std::size_t bytes = 0;
+        for (const auto& pair : m_imageMap)
+        {
+            const auto& data = pair.second;
+            if (data->image)
+                bytes += static_cast<std::size_t>(data->image->getSize().x) * data->image->getSize().y * 4;
+
+            bytes += (data->alphaMask.size() + 7) / 8;
+        }
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::ImageKeyHash::operator()(const ImageKey& key) const
+    {
+        std::size_t hash = priv::StringHash{}(key.filename);
+        for (const int value : {key.partRect.left, key.partRect.top, key.partRect.width, key.partRect.height})
+            hash = hash * 31 + std::hash<int>{}(value);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPageSize(unsigned int size)
+    {
+        m_atlasPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageSize()
+    {
+        return m_atlasPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return m_atlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(const std::shared_ptr<TextureData>& textureData)
+    {
+        if (!textureData || !textureData->atlasTexture)
+            return;
+
+        // When the pixels weren't kept then only the part of the page containing the image is copied.
+        // Downloading the entire page is only done as a last resort when no render texture can be created.
+        const sf::IntRect& rect = textureData->atlasRect;
+        if (textureData->image)
+            textureData->texture.loadFromImage(*textureData->image, textureData->rect);
+        else if (!copyTextureRegions(*textureData->atlasTexture, {{rect, {0, 0}}},
+                                     {static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height)}, textureData->texture))
+            textureData->texture.loadFromImage(textureData->atlasTexture->copyToImage(), rect);
+
+        releaseAtlasSpace(*textureData);
+        removeUnusedAtlasPages();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data)
+    {
+        const sf::Vector2u imageSize = data.image->getSize();
+        const sf::IntRect rect = getClippedPartRect(*data.image, data.rect);
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return false;
+
+        // Images are separated by one pixel to prevent neighbouring images from being visible at the borders
+        const sf::Vector2u paddedSize{static_cast<unsigned int>(rect.width) + 1, static_cast<unsigned int>(rect.height) + 1};
+        if ((paddedSize.x > m_atlasPageSize) || (paddedSize.y > m_atlasPageSize))
+            return false;
+
+        sf::Vector2u position;
+        AtlasPage* page = nullptr;
+        for (auto& existingPage : m_atlasPages)
+        {
+            if (allocateAtlasSpace(existingPage, paddedSize, position))
+            {
+                page = &existingPage;
+                break;
+            }
+        }
+
+        // Repack pages of which many images were removed before creating a new page
+        if (!page)
+        {
+            for (auto& existingPage : m_atlasPages)
+            {
+                if (!existingPage.fragmented || (existingPage.usedArea * 2 > static_cast<std::size_t>(existingPage.size) * existingPage.size))
+                    continue;
+
+                if (compactAtlasPage(existingPage) && allocateAtlasSpace(existingPage, paddedSize, position))
+                {
+                    page = &existingPage;
+                    break;
                 }
             }
         }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        if (!page)
+        {
+            AtlasPage newPage;
+            newPage.size = std::min(m_atlasPageSize, sf::Texture::getMaximumSize());
+            if ((paddedSize.x > newPage.size) || (paddedSize.y > newPage.size))
+                return false;
+
+            newPage.texture = std::make_shared<sf::Texture>();
+            if (!newPage.texture->create(newPage.size, newPage.size))
+                return false;
+
+            // Clear the page, the padding between the images has to be transparent
+            const std::vector<sf::Uint8> transparentPixels(static_cast<std::size_t>(newPage.size) * newPage.size * 4, 0);
+            newPage.texture->update(transparentPixels.data());
+
+            newPage.skyline.push_back({0, 0, newPage.size});
+            allocateAtlasSpace(newPage, paddedSize, position);
+
+            m_atlasPages.push_back(std::move(newPage));
+            page = &m_atlasPages.back();
+        }
+
+        if ((rect.left == 0) && (rect.top == 0) && (static_cast<unsigned int>(rect.width) == imageSize.x) && (static_cast<unsigned int>(rect.height) == imageSize.y))
+            page->texture->update(*data.image, position.x, position.y);
+        else
+        {
+            sf::Image partImage;
+            partImage.create(static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height));
+            partImage.copy(*data.image, 0, 0, rect);
+            page->texture->update(partImage, position.x, position.y);
+        }
+
+        page->usedArea += static_cast<std::size_t>(paddedSize.x) * paddedSize.y;
+        data.atlasTexture = page->texture;
+        data.atlasRect = {static_cast<int>(position.x), static_cast<int>(position.y), rect.width, rect.height};
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    bool TextureManager::allocateAtlasSpace(AtlasPage& page, sf::Vector2u size, sf::Vector2u& position)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        // Find the lowest position where the image fits, preferring the leftmost one when multiple positions are equally high
+        std::size_t bestIndex = page.skyline.size();
+        unsigned int bestY = page.size;
+        for (std::size_t i = 0; i < page.skyline.size(); ++i)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            const unsigned int x = page.skyline[i].x;
+            if (x + size.x > page.size)
+                break;
+
+            // The image rests on the highest segment below it
+            unsigned int y = 0;
+            unsigned int widthLeft = size.x;
+            for (std::size_t j = i; j < page.skyline.size(); ++j)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
+                y = std::max(y, page.skyline[j].y);
+                if (page.skyline[j].width >= widthLeft)
+                    break;
 
-                    return;
-                }
+                widthLeft -= page.skyline[j].width;
+            }
+
+            if ((y + size.y <= page.size) && (y < bestY))
+            {
+                bestY = y;
+                bestIndex = i;
+            }
+        }
+
+        if (bestIndex == page.skyline.size())
+            return false;
+
+        position = {page.skyline[bestIndex].x, bestY};
+
+        // Add the top of the image to the skyline and remove the parts of the segments that are now hidden below it
+        const unsigned int right = position.x + size.x;
+        page.skyline.insert(page.skyline.begin() + bestIndex, {position.x, bestY + size.y, size.x});
+        std::size_t i = bestIndex + 1;
+        while ((i < page.skyline.size()) && (page.skyline[i].x < right))
+        {
+            const unsigned int segmentRight = page.skyline[i].x + page.skyline[i].width;
+            if (segmentRight <= right)
+                page.skyline.erase(page.skyline.begin() + i);
+            else
+            {
+                page.skyline[i].width = segmentRight - right;
+                page.skyline[i].x = right;
+                break;
+            }
+        }
+
+        // Merge neighbouring segments with the same height
+        for (i = 0; i + 1 < page.skyline.size();)
+        {
+            if (page.skyline[i].y == page.skyline[i+1].y)
+            {
+                page.skyline[i].width += page.skyline[i+1].width;
+                page.skyline.erase(page.skyline.begin() + i + 1);
             }
+            else
+                ++i;
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::compactAtlasPage(AtlasPage& page)
+    {
+        std::vector<TextureData*> images;
+        for (const auto& pair : m_imageMap)
+        {
+            if (pair.second && (pair.second->atlasTexture == page.texture))
+                images.push_back(pair.second.get());
+        }
+
+        // Placing the tallest images first leaves the least gaps below the skyline
+        std::sort(images.begin(), images.end(), [](const TextureData* left, const TextureData* right){
+            return left->atlasRect.height > right->atlasRect.height;
+        });
+
+        // Find the new locations on a copy of the page, so that nothing changes when the images don't fit
+        AtlasPage packedPage;
+        packedPage.size = page.size;
+        packedPage.skyline.push_back({0, 0, page.size});
+        std::vector<std::pair<sf::IntRect, sf::Vector2u>> regions;
+        for (const auto* data : images)
+        {
+            sf::Vector2u position;
+            const sf::Vector2u paddedSize{static_cast<unsigned int>(data->atlasRect.width) + 1, static_cast<unsigned int>(data->atlasRect.height) + 1};
+            if (!allocateAtlasSpace(packedPage, paddedSize, position))
+                return false;
+
+            regions.push_back({data->atlasRect, position});
+        }
+
+        // Sprites that still use the old texture will switch to the new one the next time they are drawn
+        auto texture = std::make_shared<sf::Texture>();
+        if (!copyTextureRegions(*page.texture, regions, {page.size, page.size}, *texture))
+            return false;
+
+        for (std::size_t i = 0; i < images.size(); ++i)
+        {
+            images[i]->atlasTexture = texture;
+            images[i]->atlasRect.left = static_cast<int>(regions[i].second.x);
+            images[i]->atlasRect.top = static_cast<int>(regions[i].second.y);
+        }
+
+        page.texture = std::move(texture);
+        page.skyline = std::move(packedPage.skyline);
+        page.fragmented = false;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseAtlasSpace(TextureData& data)
+    {
+        for (auto& page : m_atlasPages)
+        {
+            if (page.texture != data.atlasTexture)
+                continue;
+
+            page.usedArea -= static_cast<std::size_t>(data.atlasRect.width + 1) * (data.atlasRect.height + 1);
+            page.fragmented = true;
+            break;
+        }
+
+        data.atlasTexture = nullptr;
+        data.atlasRect = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeUnusedAtlasPages()
+    {
+        // Sprites may still hold the texture of a destroyed page, it is released when they notice that their image was removed
+        m_atlasPages.erase(std::remove_if(m_atlasPages.begin(), m_atlasPages.end(),
+                                          [](const AtlasPage& page){ return page.usedArea == 0; }),
+                           m_atlasPages.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::shrinkSvgCache()
+    {
+        auto it = m_svgCache.end();
+        while ((m_svgCacheMemoryUsage > m_svgCacheLimit) && (it != m_svgCache.begin()))
+        {
+            --it;
+
+            // Textures that are still shown by a sprite are kept, as removing them wouldn't free any memory
+            if (it->texture.use_count() > 1)
+                continue;
+
+            m_svgCacheMemoryUsage -= static_cast<std::size_t>(it->size.x) * it->size.y * 4;
+            m_svgCacheIndex.erase(SvgCacheKey{it->svgImage, it->size.x, it->size.y});
+            it = m_svgCache.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeSvgFromCache(const SvgImage* svgImage)
+    {
+        for (auto it = m_svgCache.begin(); it != m_svgCache.end();)
+        {
+            if (it->svgImage == svgImage)
+            {
+                m_svgCacheMemoryUsage -= static_cast<std::size_t>(it->size.x) * it->size.y * 4;
+                m_svgCacheIndex.erase(SvgCacheKey{it->svgImage, it->size.x, it->size.y});
+                it = m_svgCache.erase(it);
+            }
+            else
+                ++it;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,11 +25,11 @@
 
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -145,8 +145,11 @@ namespace tgui
         m_enabled                      {other.m_enabled},
         m_visible                      {other.m_visible},
         m_parent                       {nullptr},
+        m_renderCacheOwner             {nullptr},
+        m_offscreenUpdates             {other.m_offscreenUpdates},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_unboundedArea                {other.m_unboundedArea},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
@@ -180,12 +183,15 @@ namespace tgui
         m_enabled                      {std::move(other.m_enabled)},
         m_visible                      {std::move(other.m_visible)},
         m_parent                       {nullptr},
+        m_renderCacheOwner             {nullptr},
         m_mouseHover                   {std::move(other.m_mouseHover)},
         m_mouseDown                    {std::move(other.m_mouseDown)},
         m_focused                      {std::move(other.m_focused)},
+        m_offscreenUpdates             {std::move(other.m_offscreenUpdates)},
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_unboundedArea                {std::move(other.m_unboundedArea)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
@@ -229,12 +235,15 @@ namespace tgui
             m_enabled              = other.m_enabled;
             m_visible              = other.m_visible;
             m_parent               = nullptr;
+            m_renderCacheOwner     = nullptr;
             m_mouseHover           = false;
             m_mouseDown            = false;
             m_focused              = false;
             m_animationTimeElapsed = {};
+            m_offscreenUpdates     = other.m_offscreenUpdates;
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_unboundedArea        = other.m_unboundedArea;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
@@ -278,12 +287,15 @@ namespace tgui
             m_enabled              = std::move(other.m_enabled);
             m_visible              = std::move(other.m_visible);
             m_parent               = nullptr;
+            m_renderCacheOwner     = nullptr;
             m_mouseHover           = std::move(other.m_mouseHover);
             m_mouseDown            = std::move(other.m_mouseDown);
             m_focused              = std::move(other.m_focused);
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
+            m_offscreenUpdates     = std::move(other.m_offscreenUpdates);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_unboundedArea        = std::move(other.m_unboundedArea);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
@@ -353,6 +365,12 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        // Properties such as borders can change the area that the widget occupies
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +434,11 @@ namespace tgui
 
             for (auto& layout : m_boundPositionLayouts)
                 layout->recalculateValue();
+
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            invalidateParentRenderCache();
         }
     }
 
@@ -434,6 +457,11 @@ namespace tgui
 
             for (auto& layout : m_boundSizeLayouts)
                 layout->recalculateValue();
+
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
+            invalidateParentRenderCache();
         }
     }
 
@@ -463,6 +491,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Outline Widget::getMouseAreaMargin() const
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::showWithEffect(ShowAnimationType type, sf::Time duration)
     {
         setVisible(true);
@@ -601,6 +636,8 @@ namespace tgui
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
             setFocused(false);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,6 +656,8 @@ namespace tgui
         // Refresh widget opacity if there is a different value set for enabled and disabled widgets
         if (getSharedRenderer()->getOpacityDisabled() != -1)
             rendererChanged("opacitydisabled");
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,6 +684,8 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -676,6 +717,7 @@ namespace tgui
     {
         m_inheritedFont = font;
         rendererChanged("font");
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -691,6 +733,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("opacity");
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -730,6 +773,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setUpdatedWhileOffscreen(bool updated)
+    {
+        m_offscreenUpdates = updated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isUpdatedWhileOffscreen() const
+    {
+        return m_offscreenUpdates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::canGainFocus() const
     {
         return m_enabled && m_visible && m_focusable;
@@ -757,10 +814,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::setRenderCacheOwner(Widget* owner)
+    {
+        m_renderCacheOwner = owner;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::update(sf::Time elapsedTime)
     {
         m_animationTimeElapsed += elapsedTime;
 
+        // Widgets that are being animated look different every frame
+        if (!m_showAnimations.empty())
+            invalidateParentRenderCache();
+
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -862,7 +930,11 @@ namespace tgui
 
     void Widget::leftMouseButtonNoLongerDown()
     {
-        m_mouseDown = false;
+        if (m_mouseDown)
+        {
+            m_mouseDown = false;
+            invalidateParentRenderCache();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1070,6 +1142,7 @@ namespace tgui
     {
         m_mouseHover = true;
         onMouseEnter.emit(this);
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1078,6 +1151,7 @@ namespace tgui
     {
         m_mouseHover = false;
         onMouseLeave.emit(this);
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1085,6 +1159,21 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateParentRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateParentRenderCache()
+    {
+        if (m_parent)
+            m_parent->invalidateRenderCache();
+        else if (m_renderCacheOwner)
+            m_renderCacheOwner->invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1094,14 +1183,15 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
-
-        if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+        const sf::Color vertexColor = (m_opacityCached < 1) ? Color::calcColorOpacity(color, m_opacityCached) : color;
+        const sf::Vertex vertices[] = {
+            {{0, 0}, vertexColor},
+            {{size.x, 0}, vertexColor},
+            {{0, size.y}, vertexColor},
+            {{size.x, size.y}, vertexColor}
+        };
 
-        target.draw(shape, states);
+        DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1117,10 +1207,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{size.x, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, size.y}, color}
+            };
+
+            DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1147,7 +1241,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            DrawBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
@@ -78,6 +78,8 @@ namespace tgui
 
         if (m_autoSize)
             updateSize();
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +89,8 @@ namespace tgui
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -102,6 +106,8 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,19 +85,10 @@ namespace tgui
 
     void BoxLayout::insert(std::size_t index, const Widget::Ptr& widget, const sf::String& widgetName)
     {
-        // Move the widget to the right position
-        if (index < m_widgets.size())
-        {
-            Group::add(widget, widgetName);
-
-            m_widgets.pop_back();
-            m_widgetNames.pop_back();
-
-            m_widgets.insert(m_widgets.begin() + index, widget);
-            m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
-        }
-        else // Just add the widget to the back
-            Group::add(widget, widgetName);
+        // Add the widget to the back and then move it to the right position
+        Group::add(widget, widgetName);
+        if (index < m_widgets.size() - 1)
+            setWidgetIndex(widget, index);
 
         updateWidgets();
     }
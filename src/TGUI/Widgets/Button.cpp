@@ -116,6 +116,7 @@ namespace tgui
     {
         m_string = text;
         m_text.setString(text);
+        invalidateParentRenderCache();
 
         // Set the text size when the text has a fixed size
         if (m_textSize != 0)
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/DrawBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -154,6 +155,7 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -174,7 +176,7 @@ namespace tgui
             return;
 
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        DrawBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -150,9 +150,15 @@ namespace tgui
         recalculateLineText(line);
 
         if (m_newLinesBelowOthers)
+        {
+            m_lineHeights.pushBack(line.text.getSize().y);
             m_lines.push_back(std::move(line));
+        }
         else
+        {
+            m_lineHeights.pushFront(line.text.getSize().y);
             m_lines.push_front(std::move(line));
+        }
 
         recalculateFullTextHeight();
     }
@@ -198,6 +204,7 @@ namespace tgui
         if (lineIndex < m_lines.size())
         {
             m_lines.erase(m_lines.begin() + lineIndex);
+            m_lineHeights.erase(lineIndex);
 
             recalculateFullTextHeight();
             return true;
@@ -211,6 +218,7 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_lineHeights.clear();
 
         recalculateFullTextHeight();
     }
@@ -232,9 +240,15 @@ namespace tgui
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
         {
             if (m_newLinesBelowOthers)
+            {
+                m_lineHeights.erase(0, m_lines.size() - m_maxLines);
                 m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
+            }
             else
+            {
+                m_lineHeights.erase(m_maxLines, m_lines.size() - m_maxLines);
                 m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            }
 
             recalculateFullTextHeight();
         }
@@ -301,6 +315,8 @@ namespace tgui
     {
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +331,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -326,6 +343,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // The scrollbar is drawn as part of the chat box
+        m_scroll->setRenderCacheOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ChatBox::mouseOnWidget(Vector2f pos) const
     {
         if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
@@ -418,9 +445,15 @@ namespace tgui
 
     void ChatBox::recalculateAllLines()
     {
+        std::vector<float> lineHeights;
+        lineHeights.reserve(m_lines.size());
         for (auto& line : m_lines)
+        {
             recalculateLineText(line);
+            lineHeights.push_back(line.text.getSize().y);
+        }
 
+        m_lineHeights.assign(lineHeights);
         recalculateFullTextHeight();
     }
 
@@ -428,9 +461,7 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        m_fullTextHeight = m_lineHeights.getTotalHeight();
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
@@ -445,6 +476,8 @@ namespace tgui
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
             }
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -641,14 +674,27 @@ namespace tgui
 
         states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize), -static_cast<float>(m_scroll->getValue())});
 
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        float visibleTop = static_cast<float>(m_scroll->getValue());
+
         // Put the lines at the bottom of the chat box if needed
-        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
-            states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
+        if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < visibleHeight))
+        {
+            const float offset = visibleHeight - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize);
+            states.transform.translate(0, offset);
+            visibleTop -= offset;
+        }
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that are located inside the visible area
+        std::size_t lineIndex = m_lineHeights.findIndex(visibleTop);
+        float linePosition = m_lineHeights.getPosition(lineIndex);
+        states.transform.translate(0, linePosition);
+        for (; (lineIndex < m_lines.size()) && (linePosition < visibleTop + visibleHeight); ++lineIndex)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            const float lineHeight = m_lines[lineIndex].text.getSize().y;
+            m_lines[lineIndex].text.draw(target, states);
+            states.transform.translate(0, lineHeight);
+            linePosition += lineHeight;
         }
     }
 
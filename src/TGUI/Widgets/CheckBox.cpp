@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -121,6 +122,8 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidateParentRenderCache();
+
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
@@ -258,7 +261,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                DrawBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
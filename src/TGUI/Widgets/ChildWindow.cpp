@@ -249,6 +249,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +270,8 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +289,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +379,10 @@ namespace tgui
     void ChildWindow::setResizable(bool resizable)
     {
         m_resizable = resizable;
+
+        // The borders can be clicked from outside the window when it is resizable
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +437,11 @@ namespace tgui
         Container::setParent(parent);
         if (m_keepInParent)
             setPosition(m_position);
+
+        // The title bar buttons are drawn as part of the child window
+        m_closeButton->setRenderCacheOwner(this);
+        m_minimizeButton->setRenderCacheOwner(this);
+        m_maximizeButton->setRenderCacheOwner(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -436,15 +451,11 @@ namespace tgui
         FloatRect region{getPosition(), getFullSize()};
 
         // Expand the region if the child window is resizable (to make the borders easier to click on)
-        if (m_resizable)
-        {
-            region.left -= std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getLeft());
-            region.top -= std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getTop());
-            region.width += std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getLeft())
-                            + std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getRight());
-            region.height += std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getTop())
-                             + std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getBottom());
-        }
+        const Outline margin = getMouseAreaMargin();
+        region.left -= margin.getLeft();
+        region.top -= margin.getTop();
+        region.width += margin.getLeft() + margin.getRight();
+        region.height += margin.getTop() + margin.getBottom();
 
         if (region.contains(pos))
         {
@@ -460,6 +471,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Outline ChildWindow::getMouseAreaMargin() const
+    {
+        if (!m_resizable)
+            return {};
+
+        return {std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getLeft()),
+                std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getTop()),
+                std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getRight()),
+                std::max(0.f, m_minimumResizableBorderWidthCached - m_bordersCached.getBottom())};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::leftMousePressed(Vector2f pos)
     {
         pos -= getPosition();
@@ -727,6 +751,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1047,7 +1073,7 @@ namespace tgui
 
         // Draw the widgets in the child window
         const Clipping clipping{target, states, {}, {getSize()}};
-        drawWidgetContainer(&target, states);
+        drawChildWidgets(target, states, {}, getSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +66,12 @@ namespace tgui
 
     void ClickableWidget::leftMousePressed(Vector2f pos)
     {
-        m_mouseDown = true; /// TODO: Is there any widget for which this can't be in Widget base class?
+        if (!m_mouseDown)
+        {
+            m_mouseDown = true; /// TODO: Is there any widget for which this can't be in Widget base class?
+            invalidateParentRenderCache();
+        }
+
         onMousePress.emit(this, pos - getPosition());
     }
 
@@ -79,7 +84,11 @@ namespace tgui
         if (m_mouseDown)
             onClick.emit(this, pos - getPosition());
 
-        m_mouseDown = false; /// TODO: Is there any widget for which this can't be in Widget base class?
+        if (m_mouseDown)
+        {
+            m_mouseDown = false; /// TODO: Is there any widget for which this can't be in Widget base class?
+            invalidateParentRenderCache();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
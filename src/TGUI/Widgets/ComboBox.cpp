@@ -25,6 +25,7 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
@@ -275,12 +276,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ComboBox::addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
+    {
+        const bool ret = m_listBox->addItems(itemNames, ids);
+        updateListBoxHeight();
+        return ret;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -296,6 +307,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -311,6 +323,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -323,6 +336,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidateParentRenderCache();
         m_listBox->deselectItem();
     }
 
@@ -335,6 +349,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -347,14 +362,16 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const bool ret = m_listBox->removeItemById(id);
 
-        return false;
+        m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
+
+        // Shrink the list size
+        if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
+            updateListBoxHeight();
+
+        return ret;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,6 +381,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -377,6 +395,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidateParentRenderCache();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -416,6 +435,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
         return ret;
     }
 
@@ -425,6 +445,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
         return ret;
     }
 
@@ -434,6 +455,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidateParentRenderCache();
         return ret;
     }
 
@@ -472,6 +494,8 @@ namespace tgui
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
         m_defaultText.setCharacterSize(m_listBox->getTextSize());
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,6 +510,7 @@ namespace tgui
     void ComboBox::setDefaultText(const sf::String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -513,16 +538,28 @@ namespace tgui
 
     bool ComboBox::contains(const sf::String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const sf::String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setLookupIndexEnabled(bool enabled)
+    {
+        m_listBox->setLookupIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isLookupIndexEnabled() const
+    {
+        return m_listBox->isLookupIndexEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -600,6 +637,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1));
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidateParentRenderCache();
                 onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -610,6 +648,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidateParentRenderCache();
                 onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -801,16 +840,23 @@ namespace tgui
                 if (node->propertyValuePairs["items"]->valueList.size() != node->propertyValuePairs["itemids"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<sf::String> items;
+                std::vector<sf::String> ids;
                 for (std::size_t i = 0; i < node->propertyValuePairs["items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
                 }
+
+                addItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<sf::String> items;
                 for (const auto& item : node->propertyValuePairs["items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -924,6 +970,7 @@ namespace tgui
         if (selectedItemIndex != m_previousSelectedItemIndex)
         {
             m_text.setString(m_listBox->getSelectedItem());
+            invalidateParentRenderCache();
             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
         }
     }
@@ -995,7 +1042,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the selected item
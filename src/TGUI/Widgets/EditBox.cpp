@@ -194,6 +194,7 @@ namespace tgui
         m_textBeforeSelection.setString(m_textFull.getString());
         m_textSelection.setString("");
         m_textAfterSelection.setString("");
+        invalidateParentRenderCache();
 
         if (!m_fontCached)
             return;
@@ -245,6 +246,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,6 +333,8 @@ namespace tgui
             // Set the caret behind the last character
             setCaretPosition(displayedText.getSize());
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -554,7 +558,12 @@ namespace tgui
         onMousePress.emit(this, pos);
 
         // The caret should be visible
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidateParentRenderCache();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -892,7 +901,12 @@ namespace tgui
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidateParentRenderCache();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -960,7 +974,12 @@ namespace tgui
         setCaretPosition(m_selEnd + 1);
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidateParentRenderCache();
+        }
+
         m_animationTimeElapsed = {};
 
         onTextChange.emit(this, m_text);
@@ -1403,6 +1422,8 @@ namespace tgui
         // Set the position of the caret
         caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1441,6 +1462,7 @@ namespace tgui
             m_textAfterSelection.setString("");
         }
 
+        invalidateParentRenderCache();
         if (!m_fontCached)
             return;
 
@@ -1501,6 +1523,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidateParentRenderCache();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -166,7 +166,7 @@ namespace tgui
         const Clipping clipping{target, states, {}, innerSize};
 
         // Draw the child widgets
-        drawWidgetContainer(&target, states);
+        drawChildWidgets(target, states, {}, innerSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
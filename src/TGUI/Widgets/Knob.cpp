@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -321,6 +322,8 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            const float oldAngle = m_angle;
+
             // Find out the direction that the knob should now point
             if (compareFloats(pos.x, centerPosition.x))
             {
@@ -420,6 +423,10 @@ namespace tgui
                     setValue(static_cast<int>(((m_angle + (360.0f - m_startRotation)) / allowedAngle * (m_maximum - m_minimum)) + m_minimum));
                 }
             }
+
+            // The knob follows the mouse even when the value didn't change
+            if (m_angle != oldAngle)
+                invalidateParentRenderCache();
         }
     }
 
@@ -457,6 +464,8 @@ namespace tgui
         {
             m_angle = (((m_value - m_minimum) / static_cast<float>(m_maximum - m_minimum)) * allowedAngle) + m_startRotation;
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -576,7 +585,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            DrawBatch::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -586,7 +595,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            DrawBatch::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -608,7 +617,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            DrawBatch::draw(target, thumb, states);
         }
     }
 
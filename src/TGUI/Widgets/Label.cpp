@@ -251,6 +251,9 @@ namespace tgui
         const bool autoSize = getAutoSize();
         Widget::setParent(parent);
         setAutoSize(autoSize);
+
+        // The scrollbar is drawn as part of the label
+        m_scrollbar->setRenderCacheOwner(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,6 +551,7 @@ namespace tgui
     void Label::rearrangeText()
     {
         m_lines.clear();
+        invalidateParentRenderCache();
 
         if (m_fontCached == nullptr)
             return;
@@ -25,11 +25,53 @@
 
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        using ItemLookupIndex = std::unordered_map<sf::String, std::vector<std::size_t>, priv::StringHash>;
+
+        // Adds the index of an item to the indices of the items with the same key, which are kept sorted
+        void addToItemLookupIndex(ItemLookupIndex& lookupIndex, const sf::String& key, std::size_t index)
+        {
+            auto& indices = lookupIndex[key];
+            indices.insert(std::upper_bound(indices.begin(), indices.end(), index), index);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void removeFromItemLookupIndex(ItemLookupIndex& lookupIndex, const sf::String& key, std::size_t index)
+        {
+            const auto it = lookupIndex.find(key);
+            if (it == lookupIndex.end())
+                return;
+
+            auto& indices = it->second;
+            indices.erase(std::remove(indices.begin(), indices.end(), index), indices.end());
+            if (indices.empty())
+                lookupIndex.erase(it);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Lowers the index of an item that moved up one place because an item before it was removed
+        void shiftItemLookupIndex(ItemLookupIndex& lookupIndex, const sf::String& key, std::size_t index)
+        {
+            const auto it = lookupIndex.find(key);
+            if (it == lookupIndex.end())
+                return;
+
+            auto& indices = it->second;
+            const auto indexIt = std::lower_bound(indices.begin(), indices.end(), index);
+            if ((indexIt != indices.end()) && (*indexIt == index))
+                --(*indexIt);
+        }
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -134,19 +176,7 @@ namespace tgui
             if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
-            m_itemIds.push_back(id);
+            appendItem(itemName, id);
             return true;
         }
         else // The item limit was reached
@@ -155,13 +185,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::addItems(const std::vector<sf::String>& itemNames, const std::vector<sf::String>& ids)
+    {
+        std::size_t itemCount = itemNames.size();
+        if ((m_maxItems > 0) && (m_items.size() + itemCount > m_maxItems))
+            itemCount = (m_maxItems > m_items.size()) ? (m_maxItems - m_items.size()) : 0;
+
+        m_items.reserve(m_items.size() + itemCount);
+        m_itemIds.reserve(m_itemIds.size() + itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i)
+            appendItem(itemNames[i], (i < ids.size()) ? ids[i] : "");
+
+        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
+            m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+
+        return (itemCount == itemNames.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -172,11 +222,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -215,11 +263,9 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -228,11 +274,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -256,6 +300,19 @@ namespace tgui
             m_selectedItem = m_selectedItem - 1;
         }
 
+        if (m_lookupIndexEnabled)
+        {
+            removeFromItemLookupIndex(m_itemNameIndex, m_items[index].getString(), index);
+            removeFromItemLookupIndex(m_itemIdIndex, m_itemIds[index], index);
+
+            // Only the buckets of the items after the removed one have to be updated
+            for (std::size_t i = index + 1; i < m_items.size(); ++i)
+            {
+                shiftItemLookupIndex(m_itemNameIndex, m_items[i].getString(), i);
+                shiftItemLookupIndex(m_itemIdIndex, m_itemIds[i], i);
+            }
+        }
+
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
@@ -263,6 +320,8 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         setPosition(m_position);
 
+        invalidateParentRenderCache();
+
         return true;
     }
 
@@ -277,19 +336,21 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_itemNameIndex.clear();
+        m_itemIdIndex.clear();
 
         m_scroll->setMaximum(0);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return m_items[index].getString();
 
         return "";
     }
@@ -329,11 +390,9 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItemIndex(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -342,11 +401,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -358,7 +415,14 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        if (m_lookupIndexEnabled)
+        {
+            removeFromItemLookupIndex(m_itemNameIndex, m_items[index].getString(), index);
+            addToItemLookupIndex(m_itemNameIndex, newValue, index);
+        }
+
         m_items[index].setString(newValue);
+        invalidateParentRenderCache();
         return true;
     }
 
@@ -403,6 +467,8 @@ namespace tgui
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         setPosition(m_position);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +493,8 @@ namespace tgui
             item.setCharacterSize(m_textSize);
 
         setPosition(m_position);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,9 +518,14 @@ namespace tgui
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
 
+            if (m_lookupIndexEnabled)
+                rebuildLookupIndex();
+
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
             setPosition(m_position);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,14 +553,48 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItemIndex(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return findItemIndexById(id) >= 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setLookupIndexEnabled(bool enabled)
+    {
+        if (m_lookupIndexEnabled == enabled)
+            return;
+
+        m_lookupIndexEnabled = enabled;
+        if (enabled)
+            rebuildLookupIndex();
+        else
+        {
+            m_itemNameIndex.clear();
+            m_itemIdIndex.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isLookupIndexEnabled() const
+    {
+        return m_lookupIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // The scrollbar is drawn as part of the list box
+        m_scroll->setRenderCacheOwner(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -855,16 +962,23 @@ namespace tgui
                 if (node->propertyValuePairs["items"]->valueList.size() != node->propertyValuePairs["itemids"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<sf::String> items;
+                std::vector<sf::String> ids;
                 for (std::size_t i = 0; i < node->propertyValuePairs["items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["itemids"]->valueList[i]).getString());
                 }
+
+                addItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<sf::String> items;
                 for (const auto& item : node->propertyValuePairs["items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -894,6 +1008,84 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    int ListBox::findItemIndex(const sf::String& itemName) const
+    {
+        if (m_lookupIndexEnabled)
+        {
+            const auto it = m_itemNameIndex.find(itemName);
+            return (it != m_itemNameIndex.end()) ? static_cast<int>(it->second.front()) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (m_items[i].getString() == itemName)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIndexById(const sf::String& id) const
+    {
+        if (m_lookupIndexEnabled)
+        {
+            const auto it = m_itemIdIndex.find(id);
+            return (it != m_itemIdIndex.end()) ? static_cast<int>(it->second.front()) : -1;
+        }
+
+        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
+        {
+            if (m_itemIds[i] == id)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rebuildLookupIndex()
+    {
+        m_itemNameIndex.clear();
+        m_itemIdIndex.clear();
+
+        // Indices are added in increasing order, so they can simply be appended
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            m_itemNameIndex[m_items[i].getString()].push_back(i);
+            m_itemIdIndex[m_itemIds[i]].push_back(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::appendItem(const sf::String& itemName, const sf::String& id)
+    {
+        Text newItem;
+        newItem.setFont(m_fontCached);
+        newItem.setColor(m_textColorCached);
+        newItem.setOpacity(m_opacityCached);
+        newItem.setStyle(m_textStyleCached);
+        newItem.setCharacterSize(m_textSize);
+        newItem.setString(itemName);
+        newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
+
+        if (m_lookupIndexEnabled)
+        {
+            m_itemNameIndex[itemName].push_back(m_items.size());
+            m_itemIdIndex[id].push_back(m_items.size());
+        }
+
+        m_items.push_back(std::move(newItem));
+        m_itemIds.push_back(id);
+
+        invalidateParentRenderCache();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
         if (m_selectedItem >= 0)
@@ -912,6 +1104,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_items[m_hoveringItem].setColor(m_textColorHoverCached);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
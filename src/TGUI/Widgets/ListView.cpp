@@ -25,6 +25,13 @@
 
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/WorkerPool.hpp>
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +40,130 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // Lists with fewer items than this per available thread are sorted on the calling thread
+        const std::size_t minItemsPerSortThread = 16384;
+
+        // Calls job(0) until job(jobCount-1) on the shared worker pool and waits until all of them are finished.
+        // The calling thread executes jobs as well, so it never waits for jobs that are still queued behind unrelated work.
+        template <typename Job>
+        void runSortJobs(std::size_t jobCount, const Job& job)
+        {
+            struct SharedState
+            {
+                std::atomic<std::size_t> nextJob{0};
+                std::size_t finishedJobs = 0;
+                std::mutex mutex;
+                std::condition_variable allFinished;
+            };
+
+            // The state is shared because a worker may only get to the posted function after all jobs were already executed
+            auto state = std::make_shared<SharedState>();
+            const auto executeJobs = [state,jobCount,&job]{
+                std::size_t index;
+                while ((index = state->nextJob++) < jobCount)
+                {
+                    job(index);
+
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (++state->finishedJobs == jobCount)
+                        state->allFinished.notify_all();
+                }
+            };
+
+            auto& pool = TextureManager::getWorkerPool();
+            const std::size_t helperCount = std::min<std::size_t>(pool.getThreadCount(), jobCount - 1);
+            for (std::size_t i = 0; i < helperCount; ++i)
+                pool.post(executeJobs);
+
+            executeJobs();
+
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->allFinished.wait(lock, [&]{ return state->finishedJobs == jobCount; });
+        }
+
+        // Sorts the item indices like std::stable_sort, but large lists are split in parts that are sorted on the worker pool.
+        // The sorted parts are then merged pairwise, where the merges of the same pass also run in parallel.
+        template <typename Compare>
+        void parallelStableSort(std::vector<std::size_t>& indices, const Compare& compare)
+        {
+            std::size_t partCount = indices.size() / minItemsPerSortThread;
+            if (partCount >= 2)
+                partCount = std::min<std::size_t>(partCount, TextureManager::getWorkerPool().getThreadCount() + 1);
+
+            if (partCount < 2)
+            {
+                std::stable_sort(indices.begin(), indices.end(), compare);
+                return;
+            }
+
+            std::vector<std::size_t> bounds;
+            for (std::size_t i = 0; i < partCount; ++i)
+                bounds.push_back(indices.size() * i / partCount);
+            bounds.push_back(indices.size());
+
+            const auto begin = indices.begin();
+            runSortJobs(partCount, [&](std::size_t i){ std::stable_sort(begin + bounds[i], begin + bounds[i+1], compare); });
+
+            while (bounds.size() > 2)
+            {
+                partCount = bounds.size() - 1;
+                runSortJobs(partCount / 2, [&](std::size_t i){
+                    std::inplace_merge(begin + bounds[2*i], begin + bounds[2*i+1], begin + bounds[2*i+2], compare);
+                });
+
+                std::vector<std::size_t> newBounds;
+                for (std::size_t i = 0; i < partCount; i += 2)
+                    newBounds.push_back(bounds[i]);
+                newBounds.push_back(bounds.back());
+
+                bounds = std::move(newBounds);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the number at the start of the text for numeric sorting. Texts that don't start with a number return 0.
+        double parseNumberForSorting(const sf::String& text)
+        {
+            auto it = text.begin();
+            while ((it != text.end()) && isWhitespace(*it))
+                ++it;
+
+            bool negative = false;
+            if ((it != text.end()) && ((*it == '-') || (*it == '+')))
+            {
+                negative = (*it == '-');
+                ++it;
+            }
+
+            double value = 0;
+            while ((it != text.end()) && (*it >= '0') && (*it <= '9'))
+            {
+                value = (value * 10) + (*it - '0');
+                ++it;
+            }
+
+            if ((it != text.end()) && (*it == '.'))
+            {
+                ++it;
+
+                double factor = 0.1;
+                while ((it != text.end()) && (*it >= '0') && (*it <= '9'))
+                {
+                    value += (*it - '0') * factor;
+                    factor /= 10;
+                    ++it;
+                }
+            }
+
+            return negative ? -value : value;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListView::ListView()
     {
         m_type = "ListView";
@@ -125,6 +256,7 @@ namespace tgui
             column.width = calculateAutoColumnWidth(column.text);
 
         m_columns.push_back(std::move(column));
+        m_virtualItems.clear();
         updateHorizontalScrollbarMaximum();
 
         return m_columns.size()-1;
@@ -197,6 +329,7 @@ namespace tgui
     void ListView::removeAllColumns()
     {
         m_columns.clear();
+        m_virtualItems.clear();
         updateHorizontalScrollbarMaximum();
     }
 
@@ -245,6 +378,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -279,6 +414,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const sf::String& text)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("addItem can't be called when the list view is in virtual mode.");
+            return 0;
+        }
+
 #ifdef TGUI_USE_CPP17
         Item& item = m_items.emplace_back();
 #else
@@ -288,6 +429,12 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        if (isItemOrderActive())
+        {
+            m_itemRows.push_back(-1);
+            insertItemRow(m_items.size()-1);
+        }
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -301,6 +448,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<sf::String>& itemTexts)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("addItem can't be called when the list view is in virtual mode.");
+            return 0;
+        }
+
 #ifdef TGUI_USE_CPP17
         Item& item = m_items.emplace_back();
 #else
@@ -313,6 +466,12 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        if (isItemOrderActive())
+        {
+            m_itemRows.push_back(-1);
+            insertItemRow(m_items.size()-1);
+        }
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -326,6 +485,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<sf::String>>& items)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("addMultipleItems can't be called when the list view is in virtual mode.");
+            return;
+        }
+
         for (unsigned int i = 0; i < items.size(); ++i)
         {
 #ifdef TGUI_USE_CPP17
@@ -341,6 +506,9 @@ namespace tgui
             item.icon.setOpacity(m_opacityCached);
         }
 
+        if (isItemOrderActive())
+            updateItemOrder();
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -361,6 +529,15 @@ namespace tgui
         for (const auto& text : itemTexts)
             item.texts.push_back(createText(text));
 
+        if (isItemOrderActive())
+        {
+            removeItemRow(index);
+            insertItemRow(index);
+            updateVerticalScrollbarMaximum();
+        }
+
+        invalidateParentRenderCache();
+
         return true;
     }
 
@@ -376,6 +553,16 @@ namespace tgui
             item.texts.resize(column + 1);
 
         item.texts[column] = createText(itemText);
+
+        if (isItemOrderActive())
+        {
+            removeItemRow(index);
+            insertItemRow(index);
+            updateVerticalScrollbarMaximum();
+        }
+
+        invalidateParentRenderCache();
+
         return true;
     }
 
@@ -383,6 +570,12 @@ namespace tgui
 
     bool ListView::removeItem(std::size_t index)
     {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("removeItem can't be called when the list view is in virtual mode.");
+            return false;
+        }
+
         // Update the hovered item
         if (m_hoveredItem >= 0)
         {
@@ -407,6 +600,17 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
+        if (isItemOrderActive())
+        {
+            removeItemRow(index);
+            m_itemRows.erase(m_itemRows.begin() + index);
+            for (auto& displayedItem : m_displayedItems)
+            {
+                if (displayedItem > index)
+                    --displayedItem;
+            }
+        }
+
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
 
@@ -443,18 +647,170 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_displayedItems.clear();
+        m_itemRows.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
 
+        m_virtualItemProvider = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItems.clear();
+        m_virtualItemsStart = 0;
+
         updateVerticalScrollbarMaximum();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setVirtualItems(std::size_t itemCount, const VirtualItemProvider& provider)
+    {
+        removeAllItems();
+
+        // The application decides on the order of the items in virtual mode
+        m_itemFilter = nullptr;
+        m_sortComparator = nullptr;
+        m_sortColumn = -1;
+
+        m_virtualItemProvider = provider;
+        setVirtualItemCount(itemCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setVirtualItemCount(std::size_t itemCount)
+    {
+        if (!m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("setVirtualItemCount can only be called when the list view is in virtual mode.");
+            return;
+        }
+
+        if (m_hoveredItem >= static_cast<int>(itemCount))
+            updateHoveredItem(-1);
+        if (m_selectedItem >= static_cast<int>(itemCount))
+            updateSelectedItem(-1);
+
+        // The texts of the visible items will be requested again when the list view is drawn
+        m_virtualItemCount = itemCount;
+        m_virtualItems.clear();
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isVirtual() const
+    {
+        return static_cast<bool>(m_virtualItemProvider);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortItems(std::size_t column, SortMode mode, bool ascending)
+    {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("sortItems can't be called when the list view is in virtual mode.");
+            return;
+        }
+
+        m_sortColumn = static_cast<int>(column);
+        m_sortMode = mode;
+        m_sortComparator = nullptr;
+        m_sortAscending = ascending;
+        updateItemOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sortItems(std::size_t column, const ItemComparator& comparator, bool ascending)
+    {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("sortItems can't be called when the list view is in virtual mode.");
+            return;
+        }
+
+        m_sortColumn = static_cast<int>(column);
+        m_sortComparator = comparator;
+        m_sortAscending = ascending;
+        updateItemOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeSorting()
+    {
+        if (m_sortColumn < 0)
+            return;
+
+        m_sortColumn = -1;
+        m_sortComparator = nullptr;
+        updateItemOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getSortColumn() const
+    {
+        return m_sortColumn;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isSortedAscending() const
+    {
+        return m_sortAscending;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setItemFilter(const ItemFilter& filter)
+    {
+        if (m_virtualItemProvider)
+        {
+            TGUI_PRINT_WARNING("setItemFilter can't be called when the list view is in virtual mode.");
+            return;
+        }
+
+        m_itemFilter = filter;
+        updateItemOrder();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getDisplayedItemCount() const
+    {
+        if (isItemOrderActive())
+            return m_displayedItems.size();
+        else
+            return getItemCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getDisplayedItemIndex(std::size_t row) const
+    {
+        if (row >= getDisplayedItemCount())
+            return -1;
+
+        if (isItemOrderActive())
+            return static_cast<int>(m_displayedItems[row]);
+        else
+            return static_cast<int>(row);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        const int row = (index < getItemCount()) ? getRowOfItem(static_cast<int>(index)) : -1;
+        if (row < 0)
         {
             updateSelectedItem(-1);
             return;
@@ -463,10 +819,10 @@ namespace tgui
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue((m_selectedItem + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        if (row * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(row * getItemHeight());
+        else if ((row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue((row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,6 +878,8 @@ namespace tgui
                 }
             }
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,13 +899,19 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_virtualItemProvider)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListView::getItem(std::size_t index) const
     {
+        if (m_virtualItemProvider)
+            return (index < m_virtualItemCount) ? m_virtualItemProvider(index, 0) : "";
+
         if (index >= m_items.size())
             return "";
 
@@ -562,7 +926,15 @@ namespace tgui
     std::vector<sf::String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<sf::String> row;
-        if (index < m_items.size())
+        if (m_virtualItemProvider)
+        {
+            if (index < m_virtualItemCount)
+            {
+                for (std::size_t column = 0; column < std::max<std::size_t>(1, m_columns.size()); ++column)
+                    row.push_back(m_virtualItemProvider(index, column));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -578,6 +950,15 @@ namespace tgui
     {
         std::vector<sf::String> items;
 
+        if (m_virtualItemProvider)
+        {
+            items.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                items.push_back(m_virtualItemProvider(i, 0));
+
+            return items;
+        }
+
         for (const auto& item : m_items)
         {
             if (item.texts.empty())
@@ -595,6 +976,15 @@ namespace tgui
     {
         std::vector<std::vector<sf::String>> rows;
 
+        if (m_virtualItemProvider)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<sf::String> row;
@@ -622,6 +1012,8 @@ namespace tgui
                 for (auto& text : item.texts)
                     text.setCharacterSize(m_textSize);
             }
+
+            m_virtualItems.clear();
         }
 
         updateVerticalScrollbarMaximum();
@@ -651,11 +1043,15 @@ namespace tgui
                 text.setCharacterSize(m_textSize);
         }
 
+        m_virtualItems.clear();
+
         const unsigned int headerTextSize = getHeaderTextSize();
         for (Column& column : m_columns)
             column.text.setCharacterSize(headerTextSize);
 
         m_horizontalScrollbar->setScrollAmount(m_textSize);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -788,6 +1184,7 @@ namespace tgui
     void ListView::setExpandLastColumn(bool expand)
     {
         m_expandLastColumn = expand;
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -861,6 +1258,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // The scrollbars are drawn as part of the list view
+        m_horizontalScrollbar->setRenderCacheOwner(this);
+        m_verticalScrollbar->setRenderCacheOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::mouseOnWidget(Vector2f pos) const
     {
         return FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -882,6 +1290,13 @@ namespace tgui
         {
             m_horizontalScrollbar->leftMousePressed(pos);
         }
+        else if (FloatRect{m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_paddingCached.getTop(),
+                           getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getCurrentHeaderHeight()}.contains(pos))
+        {
+            const int column = getColumnIndexBelowMouse(pos.x);
+            if (column >= 0)
+                onHeaderClick.emit(this, column);
+        }
         else if (FloatRect{m_bordersCached.getLeft() + m_paddingCached.getLeft(), m_bordersCached.getTop() + m_paddingCached.getTop() + getCurrentHeaderHeight(),
                            getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}.contains(pos))
         {
@@ -1041,6 +1456,8 @@ namespace tgui
             return onDoubleClick;
         else if (signalName == toLower(onRightClick.getName()))
             return onRightClick;
+        else if (signalName == toLower(onHeaderClick.getName()))
+            return onHeaderClick;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -1156,6 +1573,8 @@ namespace tgui
 
                 item.icon.setOpacity(m_opacityCached);
             }
+
+            m_virtualItems.clear();
         }
         else if (property == "font")
         {
@@ -1170,6 +1589,8 @@ namespace tgui
                     text.setFont(m_fontCached);
             }
 
+            m_virtualItems.clear();
+
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
             {
@@ -1222,6 +1643,7 @@ namespace tgui
             node->children.push_back(std::move(columnNode));
         }
 
+        // The items of a virtual list view belong to the application and are not saved
         for (const auto& item : m_items)
         {
             auto itemNode = std::make_unique<DataIO::Node>();
@@ -1400,7 +1822,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const sf::String& caption)
+    Text ListView::createText(const sf::String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -1433,8 +1855,270 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
-        for (auto& text : m_items[index].texts)
-            text.setColor(color);
+        if (m_virtualItemProvider)
+        {
+            // Only the items that are currently loaded have texts
+            if ((index < m_virtualItemsStart) || (index >= m_virtualItemsStart + m_virtualItems.size()))
+                return;
+
+            for (auto& text : m_virtualItems[index - m_virtualItemsStart].texts)
+                text.setColor(color);
+        }
+        else
+        {
+            for (auto& text : m_items[index].texts)
+                text.setColor(color);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color ListView::getItemTextColor(std::size_t index) const
+    {
+        if (static_cast<int>(index) == m_selectedItem)
+        {
+            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+        }
+        else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+
+        return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        if ((firstItem == m_virtualItemsStart) && (lastItem - firstItem == m_virtualItems.size()))
+            return;
+
+        // Items that remain visible are kept, the texts of the items that are no longer visible are reused for the new items
+        std::vector<Item> items(lastItem - firstItem);
+        std::vector<bool> itemsLoaded(lastItem - firstItem, false);
+        std::vector<Item> unusedItems;
+        for (std::size_t i = 0; i < m_virtualItems.size(); ++i)
+        {
+            const std::size_t index = m_virtualItemsStart + i;
+            if ((index >= firstItem) && (index < lastItem))
+            {
+                items[index - firstItem] = std::move(m_virtualItems[i]);
+                itemsLoaded[index - firstItem] = true;
+            }
+            else
+                unusedItems.push_back(std::move(m_virtualItems[i]));
+        }
+
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        for (std::size_t i = 0; i < items.size(); ++i)
+        {
+            if (itemsLoaded[i])
+                continue;
+
+            if (!unusedItems.empty())
+            {
+                items[i] = std::move(unusedItems.back());
+                unusedItems.pop_back();
+            }
+
+            auto& texts = items[i].texts;
+            if (texts.size() > columnCount)
+                texts.erase(texts.begin() + static_cast<std::ptrdiff_t>(columnCount), texts.end());
+
+            const Color color = getItemTextColor(firstItem + i);
+            for (std::size_t column = 0; column < columnCount; ++column)
+            {
+                if (column < texts.size())
+                    texts[column].setString(m_virtualItemProvider(firstItem + i, column));
+                else
+                    texts.push_back(createText(m_virtualItemProvider(firstItem + i, column)));
+
+                texts[column].setColor(color);
+            }
+        }
+
+        m_virtualItems = std::move(items);
+        m_virtualItemsStart = firstItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ListView::Item& ListView::getDrawnItem(std::size_t row) const
+    {
+        if (m_virtualItemProvider)
+            return m_virtualItems[row - m_virtualItemsStart];
+        else if (isItemOrderActive())
+            return m_items[m_displayedItems[row]];
+        else
+            return m_items[row];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isItemOrderActive() const
+    {
+        return (m_sortColumn >= 0) || m_itemFilter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowOfItem(int index) const
+    {
+        if ((index < 0) || (static_cast<std::size_t>(index) >= getItemCount()))
+            return -1;
+
+        if (isItemOrderActive())
+            return m_itemRows[index];
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& ListView::getSortText(std::size_t index) const
+    {
+        static const sf::String emptyString;
+
+        const auto& texts = m_items[index].texts;
+        const auto column = static_cast<std::size_t>(m_sortColumn);
+        return (column < texts.size()) ? texts[column].getString() : emptyString;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::compareItems(std::size_t left, std::size_t right) const
+    {
+        const sf::String& leftText = getSortText(left);
+        const sf::String& rightText = getSortText(right);
+
+        // Swapping the arguments for a descending order keeps the sort stable
+        const sf::String& first = m_sortAscending ? leftText : rightText;
+        const sf::String& second = m_sortAscending ? rightText : leftText;
+        if (m_sortComparator)
+            return m_sortComparator(first, second);
+        else if (m_sortMode == SortMode::Numeric)
+            return parseNumberForSorting(first) < parseNumberForSorting(second);
+        else
+            return first < second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemOrder()
+    {
+        updateHoveredItem(-1);
+
+        m_displayedItems.clear();
+        m_itemRows.clear();
+        if (isItemOrderActive())
+        {
+            m_displayedItems.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (!m_itemFilter || m_itemFilter(i))
+                    m_displayedItems.push_back(i);
+            }
+
+            if ((m_sortColumn >= 0) && !m_sortComparator && (m_sortMode == SortMode::Numeric))
+            {
+                // Parse the numbers only once instead of on every comparison
+                std::vector<double> numbers(m_items.size());
+                for (const auto item : m_displayedItems)
+                    numbers[item] = parseNumberForSorting(getSortText(item));
+
+                if (m_sortAscending)
+                    parallelStableSort(m_displayedItems, [&numbers](std::size_t left, std::size_t right){ return numbers[left] < numbers[right]; });
+                else
+                    parallelStableSort(m_displayedItems, [&numbers](std::size_t left, std::size_t right){ return numbers[right] < numbers[left]; });
+            }
+            else if (m_sortColumn >= 0)
+                parallelStableSort(m_displayedItems, [this](std::size_t left, std::size_t right){ return compareItems(left, right); });
+
+            m_itemRows.resize(m_items.size(), -1);
+            for (std::size_t row = 0; row < m_displayedItems.size(); ++row)
+                m_itemRows[m_displayedItems[row]] = static_cast<int>(row);
+
+            if ((m_selectedItem >= 0) && (m_itemRows[m_selectedItem] < 0))
+                updateSelectedItem(-1);
+        }
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::insertItemRow(std::size_t index)
+    {
+        if (m_itemFilter && !m_itemFilter(index))
+        {
+            if (m_selectedItem == static_cast<int>(index))
+                updateSelectedItem(-1);
+            if (m_hoveredItem == static_cast<int>(index))
+                updateHoveredItem(-1);
+            return;
+        }
+
+        // Items that compare equal are shown in the order they were added, so the row is placed after the last equal item
+        // that has a lower index and before the first equal item that has a higher index.
+        auto rowIt = m_displayedItems.end();
+        if (m_sortColumn >= 0)
+        {
+            rowIt = std::lower_bound(m_displayedItems.begin(), m_displayedItems.end(), index,
+                [this](std::size_t displayedItem, std::size_t newItem){
+                    if (compareItems(displayedItem, newItem))
+                        return true;
+                    else if (compareItems(newItem, displayedItem))
+                        return false;
+                    else
+                        return displayedItem < newItem;
+                });
+        }
+        else
+            rowIt = std::lower_bound(m_displayedItems.begin(), m_displayedItems.end(), index);
+
+        const auto row = static_cast<std::size_t>(rowIt - m_displayedItems.begin());
+        m_displayedItems.insert(rowIt, index);
+        for (std::size_t i = row; i < m_displayedItems.size(); ++i)
+            m_itemRows[m_displayedItems[i]] = static_cast<int>(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::removeItemRow(std::size_t index)
+    {
+        const int row = m_itemRows[index];
+        if (row < 0)
+            return;
+
+        m_itemRows[index] = -1;
+        m_displayedItems.erase(m_displayedItems.begin() + row);
+        for (std::size_t i = static_cast<std::size_t>(row); i < m_displayedItems.size(); ++i)
+            m_itemRows[m_displayedItems[i]] = static_cast<int>(i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getColumnIndexBelowMouse(float mouseLeft) const
+    {
+        float left = m_bordersCached.getLeft() + m_paddingCached.getLeft();
+        if (m_horizontalScrollbar->isShown())
+            left -= m_horizontalScrollbar->getValue();
+
+        unsigned int separatorWidth = m_separatorWidth;
+        if (m_showVerticalGridLines && (m_gridLinesWidth > separatorWidth))
+            separatorWidth = m_gridLinesWidth;
+
+        // The separator to the right of a column is considered to be part of that column
+        for (std::size_t col = 0; col < m_columns.size(); ++col)
+        {
+            left += m_columns[col].width + separatorWidth;
+            if (mouseLeft < left)
+                return static_cast<int>(col);
+        }
+
+        return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1461,6 +2145,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 setItemColor(m_hoveredItem, m_textColorHoverCached);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1470,6 +2156,9 @@ namespace tgui
         for (std::size_t i = 0; i < m_items.size(); ++i)
             setItemColor(i, m_textColorCached);
 
+        for (std::size_t i = 0; i < m_virtualItems.size(); ++i)
+            setItemColor(m_virtualItemsStart + i, m_textColorCached);
+
         updateSelectedAndhoveredItemColors();
     }
 
@@ -1539,8 +2228,8 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if (hoveredItem >= 0)
+            updateHoveredItem(getDisplayedItemIndex(static_cast<std::size_t>(hoveredItem)));
         else
             updateHoveredItem(-1);
     }
@@ -1583,6 +2272,8 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom if it changes due to a different viewport size
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1591,9 +2282,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getDisplayedItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1680,16 +2372,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = getDrawnItem(i);
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                m_items[i].icon.draw(target, states);
+                item.icon.draw(target, states);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -1705,7 +2398,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = getDrawnItem(i);
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -1715,12 +2409,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            item.texts[column].draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
@@ -1758,16 +2452,20 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t itemCount = getDisplayedItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        if (m_virtualItemProvider)
+            updateVirtualItems(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -1810,7 +2508,7 @@ namespace tgui
             const Clipping clipping{target, states, {}, {availableWidth, innerHeight - totalHeaderHeight}};
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 sf::Transform transformBeforeGridLines = states.transform;
 
@@ -1827,24 +2525,26 @@ namespace tgui
             }
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = getRowOfItem(m_selectedItem);
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, selectedRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                 if ((m_selectedItem == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                     drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorHoverCached);
                 else
                     drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_selectedBackgroundColorCached);
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -selectedRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_hoveredItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveredRow = getRowOfItem(m_hoveredItem);
+            if ((hoveredRow >= 0) && (m_hoveredItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 drawRectangleShape(target, states, {availableWidth, static_cast<float>(m_itemHeight)}, m_backgroundColorHoverCached);
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -hoveredRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
@@ -187,6 +188,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_unboundedArea = true; // The open menu lies outside the menu bar
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
@@ -308,6 +310,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +328,7 @@ namespace tgui
             if (m_visibleMenu == static_cast<int>(i))
                 m_visibleMenu = -1;
 
+            invalidateParentRenderCache();
             return true;
         }
 
@@ -461,6 +465,8 @@ namespace tgui
     {
         m_textSize = size;
         setTextSizeImpl(m_menus, size);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -926,6 +932,8 @@ namespace tgui
         newMenu.text.setCharacterSize(m_textSize);
         newMenu.text.setString(text);
         menus.push_back(std::move(newMenu));
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1067,6 +1075,8 @@ namespace tgui
 
         updateMenuTextColor(menus[selectedMenu], false);
         selectedMenu = -1;
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1097,6 +1107,8 @@ namespace tgui
             menu.text.setColor(m_selectedTextColorCached);
         else
             menu.text.setColor(m_textColorCached);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1355,7 +1367,7 @@ namespace tgui
                 else
                     arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
 
-                target.draw(arrow, states);
+                DrawBatch::draw(target, arrow, states);
                 states.transform = textTransform;
             }
 
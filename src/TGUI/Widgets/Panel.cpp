@@ -204,7 +204,7 @@ namespace tgui
 
         // Draw the child widgets
         const Clipping clipping{target, states, {}, contentSize};
-        drawWidgetContainer(&target, states);
+        drawChildWidgets(target, states, {}, contentSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
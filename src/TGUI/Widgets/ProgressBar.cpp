@@ -234,6 +234,8 @@ namespace tgui
         }
 
         m_textFront.setCharacterSize(m_textBack.getCharacterSize());
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -474,6 +476,8 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
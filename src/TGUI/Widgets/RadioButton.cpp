@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
@@ -153,6 +154,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +170,12 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        // The text is part of the area on which the widget can be clicked
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -663,7 +672,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            DrawBatch::draw(target, circle, states);
         }
 
         // Draw the box
@@ -697,7 +706,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            DrawBatch::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -705,7 +714,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                DrawBatch::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
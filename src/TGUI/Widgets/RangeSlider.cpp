@@ -398,6 +398,8 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown && (m_mouseDownOnThumb != 0))
         {
+            const std::pair<FloatRect, FloatRect> oldThumbs = m_thumbs;
+
             // Check in which direction the slider goes
             if (m_verticalScroll)
             {
@@ -449,6 +451,10 @@ namespace tgui
                         m_thumbs.second.left = (getSize().x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
                 }
             }
+
+            // The thumbs can move while dragging without the selection changing
+            if ((m_thumbs.first != oldThumbs.first) || (m_thumbs.second != oldThumbs.second))
+                invalidateParentRenderCache();
         }
         else // Normal mouse move
         {
@@ -632,6 +638,8 @@ namespace tgui
             m_thumbs.second.left = (innerSize.x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
             m_thumbs.second.top = m_bordersCached.getTop() + (innerSize.y - m_thumbs.second.height) / 2.0f;
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,6 +266,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollablePanel::setParent(Container* parent)
+    {
+        Panel::setParent(parent);
+
+        // The scrollbars are drawn as part of the panel, not as one of its child widgets
+        m_verticalScrollbar->setRenderCacheOwner(this);
+        m_horizontalScrollbar->setRenderCacheOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::setContentSize(Vector2f size)
     {
         m_contentSize = size;
@@ -558,10 +569,11 @@ namespace tgui
         {
             const Clipping clipping{target, states, {}, contentSize};
 
-            states.transform.translate(-static_cast<float>(m_horizontalScrollbar->getValue()),
-                                       -static_cast<float>(m_verticalScrollbar->getValue()));
+            const Vector2f scrollOffset = {static_cast<float>(m_horizontalScrollbar->getValue()),
+                                           static_cast<float>(m_verticalScrollbar->getValue())};
+            states.transform.translate(-scrollOffset);
 
-            drawWidgetContainer(&target, states);
+            drawChildWidgets(target, states, scrollOffset, contentSize);
         }
 
         if (m_verticalScrollbar->isVisible())
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,6 +199,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,7 +384,10 @@ namespace tgui
 
         // The thumb might have been dragged between two values
         if (m_mouseDown)
+        {
             updateThumbPosition();
+            invalidateParentRenderCache();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -403,6 +408,9 @@ namespace tgui
 
         pos -= getPosition();
 
+        const FloatRect oldThumb = m_thumb;
+        const Part oldHoverPart = m_mouseHoverOverPart;
+
         // Check if the mouse button went down on top of the track (or thumb)
         if (m_mouseDown && !m_mouseDownOnArrow)
         {
@@ -567,6 +575,10 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        // Only redraw when the thumb was dragged or when the mouse moved to another part of the scrollbar
+        if ((m_thumb != oldThumb) || (m_mouseHoverOverPart != oldHoverPart))
+            invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -750,6 +762,8 @@ namespace tgui
         }
 
         updateThumbPosition();
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -964,7 +978,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the track
@@ -1038,7 +1052,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
     }
 
@@ -360,6 +360,8 @@ namespace tgui
         if (!m_mouseDown)
             return;
 
+        const FloatRect oldThumb = m_thumb;
+
         // Check in which direction the slider goes
         if (m_verticalScroll)
         {
@@ -415,6 +417,10 @@ namespace tgui
                     m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
             }
         }
+
+        // The thumb can move while dragging without the value changing
+        if (m_thumb != oldThumb)
+            invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,6 +598,8 @@ namespace tgui
             if (m_invertedDirection)
                 m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -281,6 +282,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(Vector2f pos)
     {
+        const bool mouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -297,6 +300,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != mouseHoverOnTopArrow)
+            invalidateParentRenderCache();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -469,8 +475,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrowBack, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -535,8 +541,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrowBack, states);
+            DrawBatch::draw(target, arrow, states);
         }
     }
 
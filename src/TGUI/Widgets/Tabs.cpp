@@ -235,6 +235,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabs[m_selectedTab].text.setColor(m_selectedTextColorCached);
+        invalidateParentRenderCache();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -249,6 +250,7 @@ namespace tgui
         {
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
+            invalidateParentRenderCache();
         }
     }
 
@@ -284,6 +286,7 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+        invalidateParentRenderCache();
         return true;
     }
 
@@ -473,6 +476,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -493,6 +497,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -501,7 +508,11 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
 
-        m_hoveringTab = -1;
+        if (m_hoveringTab != -1)
+        {
+            m_hoveringTab = -1;
+            invalidateParentRenderCache();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -549,6 +560,8 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -798,6 +811,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_tabs[m_hoveringTab].text.setColor(m_textColorHoverCached);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,8 +27,11 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/GlyphMetricsCache.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -36,6 +39,32 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Replaces the elements in [first, last) with the given elements, without touching the elements outside the range
+        template <typename T>
+        void replaceLinesInRange(std::vector<T>& elements, std::size_t first, std::size_t last, std::vector<T>& replacement)
+        {
+            const std::size_t overwriteCount = std::min(last - first, replacement.size());
+            std::move(replacement.begin(), replacement.begin() + overwriteCount, elements.begin() + first);
+
+            if (replacement.size() > overwriteCount)
+            {
+                elements.insert(elements.begin() + last,
+                                std::make_move_iterator(replacement.begin() + overwriteCount),
+                                std::make_move_iterator(replacement.end()));
+            }
+            else
+                elements.erase(elements.begin() + first + overwriteCount, elements.begin() + last);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TextBox::TextBox()
     {
         m_type = "TextBox";
@@ -134,6 +163,8 @@ namespace tgui
         else
             m_text = text;
 
+        m_textString = "";
+        m_textStringValid = false;
         rearrangeText(false);
     }
 
@@ -141,14 +172,24 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Only the last paragraph has to be word-wrapped again, unless characters have to be removed due to the character limit
+        if ((m_maxChars > 0) && (m_text.getSize() + text.getSize() > m_maxChars))
+            setText(getText() + text);
+        else
+            replaceText(m_text.getSize(), 0, text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
-        return m_text;
+        if (!m_textStringValid)
+        {
+            m_textString = m_text.toString();
+            m_textStringValid = true;
+        }
+
+        return m_textString;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +273,8 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            m_textString = "";
+            m_textStringValid = false;
             rearrangeText(false);
         }
     }
@@ -342,26 +385,13 @@ namespace tgui
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
 
-        // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
+        if (m_lines.empty())
+            return;
 
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        // Find the line and position on that line on which the caret is located
+        m_selStart = getSelectionPosOfIndex(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +457,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // The scrollbars are drawn as part of the text box
+        m_verticalScrollbar->setRenderCacheOwner(this);
+        m_horizontalScrollbar->setRenderCacheOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextBox::mouseOnWidget(Vector2f pos) const
     {
         if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
@@ -472,14 +513,14 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 // If the click was to the right of the end of line then make sure to select the word on the left
-                if (m_lines[m_selStart.y].getSize() > 1 && (m_selStart.x == (m_lines[m_selStart.y].getSize()-1) || m_selStart.x == m_lines[m_selStart.y].getSize()))
+                if (m_lines[m_selStart.y].length > 1 && (m_selStart.x == (m_lines[m_selStart.y].length-1) || m_selStart.x == m_lines[m_selStart.y].length))
                 {
                     m_selStart.x--;
                     m_selEnd.x = m_selStart.x;
                 }
 
                 bool selectingWhitespace;
-                if (isWhitespace(m_lines[m_selStart.y][m_selStart.x]))
+                if (isWhitespace(getLineCharacter(m_selStart.y, m_selStart.x)))
                     selectingWhitespace = true;
                 else
                     selectingWhitespace = false;
@@ -487,7 +528,7 @@ namespace tgui
                 // Move start pointer to the beginning of the word/whitespace
                 for (std::size_t i = m_selStart.x; i > 0; --i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selStart.y][i-1]))
+                    if (selectingWhitespace != isWhitespace(getLineCharacter(m_selStart.y, i-1)))
                     {
                         m_selStart.x = i;
                         break;
@@ -497,15 +538,15 @@ namespace tgui
                 }
 
                 // Move end pointer to the end of the word/whitespace
-                for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length; ++i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (selectingWhitespace != isWhitespace(getLineCharacter(m_selEnd.y, i)))
                     {
                         m_selEnd.x = i;
                         break;
                     }
                     else
-                        m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                        m_selEnd.x = m_lines[m_selEnd.y].length;
                 }
             }
             else // No double clicking
@@ -523,7 +564,12 @@ namespace tgui
             updateSelectionTexts();
 
             // The caret should be visible
-            m_caretVisible = true;
+            if (!m_caretVisible)
+            {
+                m_caretVisible = true;
+                invalidateParentRenderCache();
+            }
+
             m_animationTimeElapsed = {};
         }
     }
@@ -673,7 +719,7 @@ namespace tgui
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (isWhitespace(getLineCharacter(m_selEnd.y, i-1)))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -682,7 +728,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i-1]))
+                                if (!isWhitespace(getLineCharacter(m_selEnd.y, i-1)))
                                     skippedWhitespace = true;
                             }
                         }
@@ -694,7 +740,7 @@ namespace tgui
                                 if (m_selEnd.y > 0)
                                 {
                                     m_selEnd.y--;
-                                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                    m_selEnd.x = m_lines[m_selEnd.y].length;
                                 }
                             }
                             else
@@ -722,7 +768,7 @@ namespace tgui
                         if (m_selEnd.y > 0)
                         {
                             m_selEnd.y--;
-                            m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                            m_selEnd.x = m_lines[m_selEnd.y].length;
                         }
                     }
                 }
@@ -743,11 +789,11 @@ namespace tgui
                     bool done = false;
                     for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
                     {
-                        for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].getSize(); ++i)
+                        for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length; ++i)
                         {
                             if (skippedWhitespace)
                             {
-                                if (isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (isWhitespace(getLineCharacter(m_selEnd.y, i)))
                                 {
                                     m_selEnd.x = i;
                                     done = true;
@@ -756,7 +802,7 @@ namespace tgui
                             }
                             else
                             {
-                                if (!isWhitespace(m_lines[m_selEnd.y][i]))
+                                if (!isWhitespace(getLineCharacter(m_selEnd.y, i)))
                                     skippedWhitespace = true;
                             }
                         }
@@ -773,7 +819,7 @@ namespace tgui
                             }
                             else
                             {
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                                m_selEnd.x = m_lines[m_selEnd.y].length;
                                 break;
                             }
                         }
@@ -791,7 +837,7 @@ namespace tgui
                     else
                     {
                         // Move to the next line if you are at the end of the line
-                        if (m_selEnd.x == m_lines[m_selEnd.y].getSize())
+                        if (m_selEnd.x == m_lines[m_selEnd.y].length)
                         {
                             if (m_selEnd.y + 1 < m_lines.size())
                             {
@@ -828,9 +874,9 @@ namespace tgui
             case sf::Keyboard::End:
             {
                 if (event.control)
-                    m_selEnd = {m_lines[m_lines.size()-1].getSize(), m_lines.size()-1};
+                    m_selEnd = {m_lines[m_lines.size()-1].length, m_lines.size()-1};
                 else
-                    m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                    m_selEnd.x = m_lines[m_selEnd.y].length;
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
@@ -880,7 +926,7 @@ namespace tgui
                         m_selEnd.y = m_selEnd.y + visibleLines - 2;
                 }
 
-                m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                m_selEnd.x = m_lines[m_selEnd.y].length;
 
                 if (!event.shift)
                     m_selStart = m_selEnd;
@@ -909,48 +955,26 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
+                    // When the removed character was the only one on a line created by word wrap, the caret will end up at
+                    // the end of the line above it
                     const std::size_t pos = getSelectionEnd();
                     if (pos > 0)
-                    {
-                        if (m_selEnd.x > 0)
-                        {
-                            // There is a specific case that we have to watch out for. When we are removing the last character on
-                            // a line which was placed there by word wrap and a newline follows this character then the caret
-                            // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                            if ((m_lines[m_selEnd.y].getSize() == 1) && (pos > 1) && (pos < m_text.getSize()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                            {
-                                m_selEnd.y--;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-                            }
-                            else // Just remove the character normally
-                                --m_selEnd.x;
-                        }
-                        else // At the beginning of the line
-                        {
-                            if (m_selEnd.y > 0)
-                            {
-                                --m_selEnd.y;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-
-                                if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                                    --m_selEnd.x;
-                            }
-                        }
-
-                        m_selStart = m_selEnd;
-
-                        m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
-                    }
+                        replaceText(pos - 1, 1, "");
                 }
                 else // When you did select some characters then delete them
                     deleteSelectedCharacters();
 
                 // The caret should be visible again
-                m_caretVisible = true;
+                if (!m_caretVisible)
+                {
+                    m_caretVisible = true;
+                    invalidateParentRenderCache();
+                }
+
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.hasConnections())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -961,14 +985,12 @@ namespace tgui
 
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
-                {
-                    m_text.erase(getSelectionEnd(), 1);
-                    rearrangeText(true);
-                }
+                    replaceText(getSelectionEnd(), 1, "");
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.hasConnections())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -977,7 +999,7 @@ namespace tgui
                 if (event.control && !event.alt && !event.shift && !event.system)
                 {
                     m_selStart = {0, 0};
-                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+                    m_selEnd = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
                     updateSelectionTexts();
                 }
 
@@ -1023,16 +1045,16 @@ namespace tgui
                     // Only continue pasting if you actually have to do something
                     if ((m_selStart != m_selEnd) || (clipboardContents != ""))
                     {
-                        deleteSelectedCharacters();
-
-                        m_text.insert(getSelectionEnd(), clipboardContents);
-                        m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
-
-                        m_selEnd.x += clipboardContents.getSize();
-                        m_selStart = m_selEnd;
-                        rearrangeText(true);
+                        // Replace the selected characters with the contents of the clipboard
+                        const std::size_t selStart = getSelectionStart();
+                        const std::size_t selEnd = getSelectionEnd();
+                        if (selStart <= selEnd)
+                            replaceText(selStart, selEnd - selStart, clipboardContents);
+                        else
+                            replaceText(selEnd, selStart - selEnd, clipboardContents);
 
-                        onTextChange.emit(this, m_text);
+                        if (onTextChange.hasConnections())
+                            onTextChange.emit(this, getText());
                     }
                 }
 
@@ -1044,7 +1066,12 @@ namespace tgui
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidateParentRenderCache();
+        }
+
         m_animationTimeElapsed = {};
     }
 
@@ -1059,56 +1086,47 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.getSize() + 1 > m_maxChars))
             return;
 
-        auto insert = [=]()
-        {
-            deleteSelectedCharacters();
-
-            const std::size_t caretPosition = getSelectionEnd();
-
-            m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
-
-            rearrangeText(true);
-        };
+        // The typed character replaces the selected characters
+        const std::size_t selStart = getSelectionStart();
+        const std::size_t selEnd = getSelectionEnd();
+        const std::size_t position = std::min(selStart, selEnd);
+        const std::size_t count = std::max(selStart, selEnd) - position;
 
         // If there is a scrollbar then inserting can't go wrong
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
-            insert();
+            replaceText(position, count, key);
         }
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            sf::String oldText = m_text;
-            const auto oldSelStart = m_selStart;
-            const auto oldSelEnd = m_selEnd;
+            const sf::String replacedText = m_text.substring(position, count);
 
             // Try to insert the character
-            insert();
+            replaceText(position, count, key);
 
             // Undo the insert if the text does not fit
             if (m_lines.size() > getInnerSize().y / m_lineHeight)
             {
-                m_text = oldText;
-                m_selStart = oldSelStart;
-                m_selEnd = oldSelEnd;
+                replaceText(position, 1, replacedText);
 
-                rearrangeText(true);
+                m_selStart = getSelectionPosOfIndex(selStart);
+                m_selEnd = getSelectionPosOfIndex(selEnd);
+                updateSelectionTexts();
             }
         }
 
         // The caret should be visible again
-        m_caretVisible = true;
+        if (!m_caretVisible)
+        {
+            m_caretVisible = true;
+            invalidateParentRenderCache();
+        }
+
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        if (onTextChange.hasConnections())
+            onTextChange.emit(this, getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1142,7 +1160,7 @@ namespace tgui
 
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
 
         // Find on which line the mouse is
         std::size_t lineNumber;
@@ -1163,24 +1181,21 @@ namespace tgui
 
         // Check if you clicked behind everything
         if (lineNumber + 1 > m_lines.size())
-            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
+            return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].length, m_lines.size()-1);
 
         // Find between which character the mouse is standing
+        auto& glyphMetrics = priv::GlyphMetricsCache::get(m_fontCached, getTextSize(), false);
         float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSize) - m_horizontalScrollbar->getValue();
         std::uint32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
+        for (std::size_t i = 0; i < m_lines[lineNumber].length; ++i)
         {
-            float charWidth;
-            const std::uint32_t curChar = m_lines[lineNumber][i];
+            const std::uint32_t curChar = getLineCharacter(lineNumber, i);
             //if (curChar == '\n')
-            //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
-            //else
-            if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+            //    return sf::Vector2<std::size_t>(m_lines[lineNumber].length - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
 
-            const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
+            // The cache measures a tab as 4 spaces, just like the text is drawn
+            const float charWidth = glyphMetrics.getAdvance(curChar);
+            const float kerning = glyphMetrics.getKerning(prevChar, curChar);
             if (width + charWidth + kerning <= position.x)
                 width += charWidth + kerning;
             else
@@ -1195,27 +1210,58 @@ namespace tgui
         }
 
         // You clicked behind the last character
-        return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize(), lineNumber);
+        return sf::Vector2<std::size_t>(m_lines[lineNumber].length, lineNumber);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t TextBox::getIndexOfSelectionPos(sf::Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
-        {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
+        if (selectionPos.y >= m_lines.size())
+            return selectionPos.x;
 
-            return counter;
-        };
+        return m_lines[selectionPos.y].start + selectionPos.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2<std::size_t> TextBox::getSelectionPosOfIndex(std::size_t index) const
+    {
+        // Find the first line that ends at or behind the index. When the index lies between two lines that were split by
+        // word-wrap, the position at the end of the first line is used.
+        std::size_t low = 0;
+        std::size_t high = m_lines.size();
+        while (low < high)
+        {
+            const std::size_t middle = low + (high - low) / 2;
+            if (m_lines[middle].start + m_lines[middle].length < index)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        // If the index lies behind the text then the position at the end of the text is returned
+        if (low == m_lines.size())
+            return sf::Vector2<std::size_t>(m_lines.back().length, m_lines.size() - 1);
+        else
+            return sf::Vector2<std::size_t>(index - m_lines[low].start, low);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextBox::getLine(std::size_t lineIndex) const
+    {
+        return m_text.substring(m_lines[lineIndex].start, m_lines[lineIndex].length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t TextBox::getLineCharacter(std::size_t lineIndex, std::size_t position) const
+    {
+        if (position >= m_lines[lineIndex].length)
+            return 0;
 
-        return findIndex(selectionPos.y) + selectionPos.x;
+        return m_text[m_lines[lineIndex].start + position];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1234,17 +1280,9 @@ namespace tgui
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
             if (selStart <= selEnd)
-            {
-                m_text.erase(selStart, selEnd - selStart);
-                m_selEnd = m_selStart;
-            }
+                replaceText(selStart, selEnd - selStart, "");
             else
-            {
-                m_text.erase(selEnd, selStart - selEnd);
-                m_selStart = m_selEnd;
-            }
-
-            rearrangeText(true);
+                replaceText(selEnd, selStart - selEnd, "");
         }
     }
 
@@ -1256,122 +1294,162 @@ namespace tgui
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        sf::String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
-            // Find the maximum width of one line
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
-            if (m_verticalScrollbar->isShown())
-                maxLineWidth -= m_verticalScrollbar->getSize().x;
+            maxLineWidth = getWordWrapWidth();
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
         }
 
-        // Store the current selection position when we are keeping the selection
-        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
-        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+        // Store the current selection position when we are keeping the selection, otherwise the caret goes to the back of the text
+        const std::size_t selStart = keepSelection ? getSelectionStart() : m_text.getSize();
+        const std::size_t selEnd = keepSelection ? getSelectionEnd() : m_text.getSize();
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
+        // Split the text in multiple lines
         m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+        splitTextIntoLines(0, m_text.getSize(), maxLineWidth, m_lines);
+        m_lineWidthsValid = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+        finishRearrangingText(selStart, selEnd);
+    }
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().getSize() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().getSize();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSize);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            searchPosStart = newLinePos + 1;
+    void TextBox::replaceText(std::size_t position, std::size_t count, const sf::String& replacement)
+    {
+        if (count > m_text.getSize() - position)
+            count = m_text.getSize() - position;
+
+        // The lines can only be reused when they still match the text
+        const bool measureLines = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
+        const bool linesValid = !m_lines.empty() && (m_lines.back().start + m_lines.back().length == m_text.getSize())
+                                && (!measureLines || m_lineWidthsValid);
+
+        // Find the start of the first paragraph and the end of the last paragraph that are touched by the change
+        std::size_t paragraphStart = m_text.findLast('\n', position);
+        if (paragraphStart != sf::String::InvalidPos)
+            ++paragraphStart;
+        else
+            paragraphStart = 0;
+
+        std::size_t oldParagraphEnd = m_text.find('\n', position + count);
+        if (oldParagraphEnd == sf::String::InvalidPos)
+            oldParagraphEnd = m_text.getSize();
+
+        const bool changeInLastParagraph = (oldParagraphEnd == m_text.getSize());
+
+        m_text.erase(position, count);
+        m_text.insert(position, replacement);
+        m_textString = "";
+        m_textStringValid = false;
+
+        const std::size_t caretPosition = position + replacement.getSize();
+        const std::size_t newParagraphEnd = oldParagraphEnd - count + replacement.getSize();
+
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
+            maxLineWidth = getWordWrapWidth();
+
+        if (!linesValid || (m_lineHeight == 0) || (m_fontCached == nullptr)
+         || ((m_horizontalScrollbarPolicy == Scrollbar::Policy::Never) && (maxLineWidth <= 0)))
+        {
+            rearrangeText(false);
+            setCaretPosition(caretPosition);
+            return;
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+        // Find which lines belonged to the changed paragraphs. Every line starts at a different position, except for an empty
+        // paragraph which only consists of a single line, so the first line of a paragraph is found by its start position.
+        const auto compareLineStart = [](const Line& line, std::size_t start){ return line.start < start; };
+        const std::size_t firstLine = static_cast<std::size_t>(std::lower_bound(m_lines.begin(), m_lines.end(), paragraphStart, compareLineStart) - m_lines.begin());
+        std::size_t lastLine = m_lines.size();
+        if (!changeInLastParagraph)
+            lastLine = static_cast<std::size_t>(std::lower_bound(m_lines.begin(), m_lines.end(), oldParagraphEnd + 1, compareLineStart) - m_lines.begin());
+
+        std::vector<Line> lines;
+        splitTextIntoLines(paragraphStart, newParagraphEnd, maxLineWidth, lines);
+
+        // The lines behind the changed paragraphs have moved
+        for (std::size_t i = lastLine; i < m_lines.size(); ++i)
+            m_lines[i].start = m_lines[i].start - count + replacement.getSize();
+
+        replaceLinesInRange(m_lines, firstLine, lastLine, lines);
+        m_lineWidthsValid = measureLines;
+
+        finishRearrangingText(caretPosition, caretPosition);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::splitTextIntoLines(std::size_t start, std::size_t end, float maxLineWidth, std::vector<Line>& lines) const
+    {
+        const bool measureLines = (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && !m_monospacedFontOptimizationEnabled;
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+        // Every paragraph is word-wrapped on its own, so that changing one paragraph can't influence the lines of another one
+        std::size_t paragraphStart = start;
+        while (true)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            std::size_t paragraphEnd = m_text.find('\n', paragraphStart);
+            if ((paragraphEnd == sf::String::InvalidPos) || (paragraphEnd > end))
+                paragraphEnd = end;
+
+            sf::String paragraph = m_text.substring(paragraphStart, paragraphEnd - paragraphStart);
+            if (maxLineWidth > 0)
+                paragraph = Text::wordWrap(maxLineWidth, paragraph, m_fontCached, m_textSize, false, false);
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            // Word-wrap only inserts newlines, so the lines can be mapped back to the positions in the original text
+            std::size_t lineStart = paragraphStart;
+            std::size_t searchPosStart = 0;
+            std::size_t newLinePos = 0;
+            while (newLinePos != sf::String::InvalidPos)
             {
-                index += m_lines[i].getSize();
+                newLinePos = paragraph.find('\n', searchPosStart);
 
-                if (!newSelStartFound && (index >= selStart))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - selStart), i);
+                const std::size_t lineLength = (newLinePos != sf::String::InvalidPos) ? (newLinePos - searchPosStart) : (paragraph.getSize() - searchPosStart);
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+                float lineWidth = 0;
+                if (measureLines)
+                    lineWidth = Text::getLineWidth(paragraph.substring(searchPosStart, lineLength), m_fontCached, m_textSize);
 
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - selEnd), i);
+                lines.push_back({lineStart, lineLength, lineWidth});
+                lineStart += lineLength;
+                searchPosStart = newLinePos + 1;
+            }
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+            if (paragraphEnd == end)
+                break;
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+            paragraphStart = paragraphEnd + 1;
+        }
+    }
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::finishRearrangingText(std::size_t selectionStart, std::size_t selectionEnd)
+    {
+        m_maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            if (m_monospacedFontOptimizationEnabled)
             {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
+                // Only the line with the most characters has to be measured
+                const auto longestLineIt = std::max_element(m_lines.begin(), m_lines.end(),
+                    [](const Line& left, const Line& right){ return left.length < right.length; });
+
+                m_maxLineWidth = Text::getLineWidth(getLine(static_cast<std::size_t>(longestLineIt - m_lines.begin())), m_fontCached, m_textSize);
             }
-            else // The text has changed too much, the selection can't be kept
+            else // Not using optimization for monospaced font, so use the width of every line
             {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                m_maxLineWidth = std::max_element(m_lines.begin(), m_lines.end(),
+                    [](const Line& left, const Line& right){ return left.width < right.width; })->width;
             }
         }
-        else // Set the caret at the back of the text
-        {
-            m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-            m_selEnd = m_selStart;
-        }
+
+        m_selStart = getSelectionPosOfIndex(selectionStart);
+        m_selEnd = getSelectionPosOfIndex(selectionEnd);
 
         updateScrollbars();
 
@@ -1408,6 +1486,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float TextBox::getWordWrapWidth() const
+    {
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+        if (m_verticalScrollbar->isShown())
+            maxLineWidth -= m_verticalScrollbar->getSize().x;
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::updateScrollbars()
     {
         if (m_horizontalScrollbar->isShown())
@@ -1437,71 +1527,6 @@ namespace tgui
 
     void TextBox::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
-
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
-
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
-
-                m_textAfterSelection2.setString(string);
-            }
-        }
-
         // Check if the caret is located above or below the view
         if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
         {
@@ -1517,11 +1542,11 @@ namespace tgui
         // Position the caret
         {
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            sf::Text tempText{m_lines[m_selEnd.y].substring(0, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
+            sf::Text tempText{m_text.substring(m_lines[m_selEnd.y].start, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
 
             float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
+            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].length))
+                kerning = m_fontCached.getKerning(getLineCharacter(m_selEnd.y, m_selEnd.x - 1), getLineCharacter(m_selEnd.y, m_selEnd.x), m_textSize);
 
             m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
@@ -1582,6 +1607,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidateParentRenderCache();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -1594,96 +1623,168 @@ namespace tgui
         if (!m_fontCached)
             return;
 
+        invalidateParentRenderCache();
+        updateVisibleLineRange();
+
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        const float lineSpacing = m_fontCached.getLineSpacing(m_textSize);
+
+        // Only the visible lines are placed in the texts, so that the time needed doesn't depend on the length of the text
+        const std::size_t firstVisibleLine = std::min(m_topLine, m_lines.size());
+        const std::size_t lastVisibleLine = std::min(m_topLine + m_visibleLines + 1, m_lines.size());
+        const auto isLineVisible = [=](std::size_t lineIndex){ return (lineIndex >= firstVisibleLine) && (lineIndex < lastVisibleLine); };
+        const auto joinLines = [this](std::size_t first, std::size_t last){
+            sf::String string;
+            for (std::size_t i = first; i < last; ++i)
+                string += getLine(i) + "\n";
+            return string;
+        };
 
-        // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstVisibleLine) * lineSpacing});
+
+        // If there is no selection then just put the visible lines in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+            m_textBeforeSelection.setString(joinLines(firstVisibleLine, lastVisibleLine));
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+            return;
+        }
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
 
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
 
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
+        // Set the text before the selection
+        {
+            sf::String string = joinLines(firstVisibleLine, std::min(selectionStart.y, lastVisibleLine));
+            if (isLineVisible(selectionStart.y))
+                string += m_text.substring(m_lines[selectionStart.y].start, selectionStart.x);
 
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+            m_textBeforeSelection.setString(string);
+        }
 
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
+        // Set the selected text
+        if (!isLineVisible(selectionStart.y))
+            m_textSelection1.setString("");
+        else if (selectionStart.y == selectionEnd.y)
+            m_textSelection1.setString(m_text.substring(m_lines[selectionStart.y].start + selectionStart.x, selectionEnd.x - selectionStart.x));
+        else
+            m_textSelection1.setString(m_text.substring(m_lines[selectionStart.y].start + selectionStart.x, m_lines[selectionStart.y].length - selectionStart.x));
 
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
+        const std::size_t firstLineSelection2 = std::max(selectionStart.y + 1, firstVisibleLine);
+        if (selectionStart.y != selectionEnd.y)
+        {
+            sf::String string = joinLines(firstLineSelection2, std::min(selectionEnd.y, lastVisibleLine));
+            if (isLineVisible(selectionEnd.y))
+                string += m_text.substring(m_lines[selectionEnd.y].start, selectionEnd.x);
 
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
+            m_textSelection2.setString(string);
+        }
+        else
+            m_textSelection2.setString("");
 
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+        // Set the text after the selection
+        if (isLineVisible(selectionEnd.y))
+            m_textAfterSelection1.setString(m_text.substring(m_lines[selectionEnd.y].start + selectionEnd.x, m_lines[selectionEnd.y].length - selectionEnd.x));
+        else
+            m_textAfterSelection1.setString("");
 
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
+        const std::size_t firstLineAfterSelection2 = std::max(selectionEnd.y + 1, firstVisibleLine);
+        m_textAfterSelection2.setString(joinLines(firstLineAfterSelection2, lastVisibleLine));
 
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
+        // Calculate the position of the text objects
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length))
+            kerningSelectionStart = m_fontCached.getKerning(getLineCharacter(selectionStart.y, selectionStart.x-1), getLineCharacter(selectionStart.y, selectionStart.x), m_textSize);
 
-                sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length))
+            kerningSelectionEnd = m_fontCached.getKerning(getLineCharacter(selectionEnd.y, selectionEnd.x-1), getLineCharacter(selectionEnd.y, selectionEnd.x), m_textSize);
 
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
+        if (selectionStart.x > 0)
+        {
+            m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y * m_lineHeight)});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
 
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
+        m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)
+                                                  + (static_cast<float>(firstLineSelection2 - selectionStart.y - 1) * lineSpacing)});
 
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
+        if (selectionStart.y != selectionEnd.y)
+        {
+            m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
+                                               static_cast<float>(selectionEnd.y * m_lineHeight)});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)
+                                                       + (static_cast<float>(firstLineAfterSelection2 - selectionEnd.y - 1) * lineSpacing)});
+
+        // Recalculate the selection rectangles of the visible lines
+        if (isLineVisible(selectionStart.y))
+        {
+            m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
+
+            if (!(m_lines[selectionStart.y].length == 0))
+            {
+                m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
+
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                    m_selectionRects.back().width += kerningSelectionEnd;
             }
+
+            if (selectionStart.y != selectionEnd.y)
+                m_selectionRects.back().width += textOffset;
         }
 
-        recalculateVisibleLines();
+        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
+        for (std::size_t i = firstLineSelection2; i < std::min(selectionEnd.y, lastVisibleLine); ++i)
+        {
+            m_selectionRects.push_back({0, static_cast<float>(i * m_lineHeight), 2 * textOffset, static_cast<float>(m_lineHeight)});
+
+            if (!(m_lines[i].length == 0))
+            {
+                tempText.setString(getLine(i));
+                m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
+            }
+        }
+
+        if ((selectionStart.y != selectionEnd.y) && isLineVisible(selectionEnd.y))
+        {
+            tempText.setString(m_text.substring(m_lines[selectionEnd.y].start, selectionEnd.x));
+            m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight),
+                                        textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::recalculateVisibleLines()
+    {
+        const std::size_t oldTopLine = m_topLine;
+        const std::size_t oldVisibleLines = m_visibleLines;
+
+        updateVisibleLineRange();
+
+        // The texts only contain the visible lines, so they have to be updated when scrolling to other lines
+        if ((m_topLine != oldTopLine) || (m_visibleLines != oldVisibleLines))
+            recalculatePositions();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleLineRange()
     {
         if (m_lineHeight == 0)
             return;
@@ -75,84 +75,65 @@ namespace tgui
             newNode->text = oldNode->text;
             newNode->depth = oldNode->depth;
             newNode->expanded = oldNode->expanded;
+            newNode->populateOnExpand = oldNode->populateOnExpand;
             newNode->parent = parent;
 
             for (const auto& oldChild : oldNode->nodes)
+            {
                 newNode->nodes.push_back(cloneNode(oldChild, newNode.get()));
+                newNode->nodesByText.emplace(oldChild->text.getString(), newNode->nodes.back().get());
+            }
 
             return newNode;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void cloneVisibleNodeList(const std::vector<std::shared_ptr<TreeView::Node>>& oldNodes,
-                                  std::vector<std::shared_ptr<TreeView::Node>>& newNodes,
-                                  const std::vector<std::shared_ptr<TreeView::Node>>& oldList,
-                                  std::vector<std::shared_ptr<TreeView::Node>>& newList)
+        std::size_t countVisibleChildNodes(const TreeView::Node& node)
         {
-            assert(oldNodes.size() == newNodes.size());
-            assert(oldList.size() == newList.size());
+            if (!node.expanded)
+                return 0;
 
-            for (unsigned int i = 0; i < oldNodes.size(); ++i)
-            {
-                for (unsigned int j = 0; j < oldList.size(); ++j)
-                {
-                    if (oldNodes[i] == oldList[j])
-                        newList[j] = newNodes[i];
-                }
+            std::size_t count = node.nodes.size();
+            for (const auto& child : node.nodes)
+                count += countVisibleChildNodes(*child);
 
-                cloneVisibleNodeList(oldNodes[i]->nodes, newNodes[i]->nodes, oldList, newList);
-            }
+            return count;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void expandOrCollapseAll(std::vector<std::shared_ptr<TreeView::Node>>& nodes, bool expandNode)
+        std::vector<sf::String> getNodeHierarchy(const TreeView::Node* node)
         {
-            for (auto& node : nodes)
+            std::vector<sf::String> hierarchy;
+            while (node)
             {
-                if (!node->nodes.empty())
-                {
-                    node->expanded = expandNode;
-                    expandOrCollapseAll(node->nodes, expandNode);
-                }
+                hierarchy.insert(hierarchy.begin(), node->text.getString());
+                node = node->parent;
             }
+
+            return hierarchy;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool removeItemImpl(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<std::shared_ptr<TreeView::Node>>& nodes)
+        float getNodeTextRight(const TreeView::Node& node, float rightPadding)
         {
-            for (auto it = nodes.begin(); it != nodes.end(); ++it)
-            {
-                if ((*it)->text.getString() != hierarchy[parentIndex])
-                    continue;
-
-                if (parentIndex + 1 == hierarchy.size())
-                {
-                    nodes.erase(it);
-                    return true;
-                }
-                else
-                {
-                    // Return false if some menu in the hierarchy couldn't be found
-                    if (!removeItemImpl(hierarchy, removeParentsWhenEmpty, parentIndex + 1, (*it)->nodes))
-                        return false;
-
-                    // If parents don't have to be removed as well then we are done
-                    if (!removeParentsWhenEmpty)
-                        return true;
+            return node.text.getPosition().x + node.text.getSize().x + rightPadding;
+        }
 
-                    // Also delete the parent if empty
-                    if ((*it)->nodes.empty())
-                        nodes.erase(it);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    return true;
+        void expandOrCollapseAll(std::vector<std::shared_ptr<TreeView::Node>>& nodes, bool expandNode)
+        {
+            for (auto& node : nodes)
+            {
+                if (!node->nodes.empty())
+                {
+                    node->expanded = expandNode;
+                    expandOrCollapseAll(node->nodes, expandNode);
                 }
             }
-
-            // The hierarchy doesn't exist
-            return false;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,23 +154,6 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        TreeView::Node* findNode(const std::vector<std::shared_ptr<TreeView::Node>>& nodes, const std::vector<sf::String>& hierarchy, unsigned int parentIndex)
-        {
-            for (auto& node : nodes)
-            {
-                if (node->text.getString() != hierarchy[parentIndex])
-                    continue;
-                else if (parentIndex + 1 == hierarchy.size())
-                    return node.get();
-                else
-                    return findNode(node->nodes, hierarchy, parentIndex + 1);
-            }
-
-            return nullptr;
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
         void saveItems(std::unique_ptr<DataIO::Node>& parentNode, const std::vector<std::shared_ptr<TreeView::Node>>& items)
         {
             for (const auto& item : items)
@@ -259,6 +223,7 @@ namespace tgui
         onDoubleClick                       {other.onDoubleClick},
         onExpand                            {other.onExpand},
         onCollapse                          {other.onCollapse},
+        onPopulate                          {other.onPopulate},
         m_selectedItem                      {other.m_selectedItem},
         m_hoveredItem                       {other.m_hoveredItem},
         m_itemHeight                        {other.m_itemHeight},
@@ -287,12 +252,14 @@ namespace tgui
         m_textStyleCached                   {other.m_textStyleCached}
     {
         for (const auto& node : other.m_nodes)
+        {
             m_nodes.push_back(cloneNode(node, nullptr));
+            m_nodesByText.emplace(node->text.getString(), m_nodes.back().get());
+        }
 
-        m_visibleNodes.resize(other.m_visibleNodes.size(), nullptr);
-        cloneVisibleNodeList(other.m_nodes, m_nodes, other.m_visibleNodes, m_visibleNodes);
-
-        assert(std::count(m_visibleNodes.begin(), m_visibleNodes.end(), nullptr) == 0);
+        // The copied tree has the same structure, so the same nodes are visible
+        collectVisibleNodes(m_nodes, m_visibleNodes);
+        assert(m_visibleNodes.size() == other.m_visibleNodes.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,8 +275,10 @@ namespace tgui
             std::swap(onDoubleClick,                        temp.onDoubleClick);
             std::swap(onExpand,                             temp.onExpand);
             std::swap(onCollapse,                           temp.onCollapse);
+            std::swap(onPopulate,                           temp.onPopulate);
             std::swap(m_nodes,                              temp.m_nodes);
             std::swap(m_visibleNodes,                       temp.m_visibleNodes);
+            std::swap(m_nodesByText,                        temp.m_nodesByText);
             std::swap(m_selectedItem,                       temp.m_selectedItem);
             std::swap(m_hoveredItem,                        temp.m_hoveredItem);
             std::swap(m_itemHeight,                         temp.m_itemHeight);
@@ -421,18 +390,37 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
+        Node* parent = nullptr;
         if (hierarchy.size() >= 2)
         {
-            auto* node = findParentNode(hierarchy, 0, m_nodes, nullptr, createParents);
-            if (!node)
+            parent = findParentNode(hierarchy, createParents);
+            if (!parent)
                 return false;
+        }
+
+        createNode(parent, hierarchy.back());
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TreeView::addLazyItem(const std::vector<sf::String>& hierarchy, bool createParents)
+    {
+        if (hierarchy.empty())
+            return false;
 
-            createNode(node->nodes, node, hierarchy.back());
+        Node* parent = nullptr;
+        if (hierarchy.size() >= 2)
+        {
+            parent = findParentNode(hierarchy, createParents);
+            if (!parent)
+                return false;
         }
-        else // Root node
-            createNode(m_nodes, nullptr, hierarchy.back());
 
-        markNodesDirty();
+        // The node has no children yet, so changing its state doesn't affect the visible rows
+        auto* node = createNode(parent, hierarchy.back());
+        node->expanded = false;
+        node->populateOnExpand = true;
         return true;
     }
 
@@ -477,7 +465,7 @@ namespace tgui
                 return false;
         }
 
-        auto* node = findNode(m_nodes, hierarchy, 0);
+        auto* node = findNode(hierarchy);
         if (!node)
             return false;
 
@@ -504,9 +492,25 @@ namespace tgui
 
     bool TreeView::removeItem(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty)
     {
-        const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
-        markNodesDirty();
-        return ret;
+        auto* node = findNode(hierarchy);
+        if (!node)
+            return false;
+
+        auto* parent = node->parent;
+        removeNode(node);
+
+        // Also delete the parents that became empty
+        if (removeParentsWhenEmpty)
+        {
+            while (parent && parent->nodes.empty())
+            {
+                auto* grandParent = parent->parent;
+                removeNode(parent);
+                parent = grandParent;
+            }
+        }
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -514,6 +518,7 @@ namespace tgui
     void TreeView::removeAllItems()
     {
         m_nodes.clear();
+        m_nodesByText.clear();
         markNodesDirty();
     }
 
@@ -543,24 +548,18 @@ namespace tgui
         if (index >= m_visibleNodes.size())
             return;
 
-        if (m_visibleNodes[index]->nodes.empty())
+        auto* node = m_visibleNodes[index].get();
+        if (node->nodes.empty() && !node->populateOnExpand)
             return;
 
-        std::vector<sf::String> hierarchy;
-        auto* node = m_visibleNodes[index].get();
-        while (node)
-        {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
-            node = node->parent;
-        }
+        const std::vector<sf::String> hierarchy = getNodeHierarchy(node);
 
-        m_visibleNodes[index]->expanded = !m_visibleNodes[index]->expanded;
-        if (m_visibleNodes[index]->expanded)
+        const bool expandNode = !node->expanded;
+        expandOrCollapseNode(node, expandNode);
+        if (expandNode)
             onExpand.emit(this, hierarchy.back(), hierarchy);
         else
             onCollapse.emit(this, hierarchy.back(), hierarchy);
-
-        markNodesDirty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +608,8 @@ namespace tgui
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
         setTextSizeImpl(m_nodes, textSize);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -620,6 +621,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TreeView::setParent(Container* parent)
+    {
+        Widget::setParent(parent);
+
+        // The scrollbars are drawn as part of the tree view
+        m_horizontalScrollbar->setRenderCacheOwner(this);
+        m_verticalScrollbar->setRenderCacheOwner(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TreeView::mouseOnWidget(Vector2f pos) const
     {
         return FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -826,6 +838,8 @@ namespace tgui
             return onExpand;
         else if (signalName == toLower(onCollapse.getName()))
             return onCollapse;
+        else if (signalName == toLower(onPopulate.getName()))
+            return onPopulate;
         else
             return Widget::getSignal(std::move(signalName));
     }
@@ -968,7 +982,7 @@ namespace tgui
         if (node->propertyValuePairs["textsize"])
             setTextSize(tgui::stoi(node->propertyValuePairs["textsize"]->value));
 
-        loadItems(node, m_nodes, nullptr);
+        loadItems(node, nullptr);
 
         // Remove the 'Item' nodes as they have been processed
         node->children.erase(std::remove_if(node->children.begin(), node->children.end(),
@@ -990,7 +1004,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent)
+    void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, Node* parent)
     {
         for (const auto& childNode : node->children)
         {
@@ -1001,11 +1015,11 @@ namespace tgui
                 throw Exception{"Failed to parse 'Item' property, expected a nested 'Text' propery"};
 
             const sf::String itemText = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["text"]->value).getString();
-            createNode(items, parent, itemText);
+            auto* item = createNode(parent, itemText);
 
             // Recursively handle the menu nodes
             if (!childNode->children.empty())
-                loadItems(childNode, items.back()->nodes, items.back().get());
+                loadItems(childNode, item);
 
             // Menu items can also be stored in an string array in the 'Items' property instead of as a nested Menu section
             if (childNode->propertyValuePairs["items"])
@@ -1016,7 +1030,7 @@ namespace tgui
                 for (std::size_t i = 0; i < childNode->propertyValuePairs["items"]->valueList.size(); ++i)
                 {
                     const sf::String subItemText = Deserializer::deserialize(ObjectConverter::Type::String, childNode->propertyValuePairs["items"]->valueList[i]).getString();
-                    createNode(items.back()->nodes, items.back().get(), subItemText);
+                    createNode(item, subItemText);
                 }
             }
         }
@@ -1024,29 +1038,159 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int TreeView::updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos)
+    void TreeView::collectVisibleNodes(const std::vector<std::shared_ptr<Node>>& nodes, std::vector<std::shared_ptr<Node>>& visibleNodes) const
     {
-        for (auto& node : nodes)
+        for (const auto& node : nodes)
         {
-            m_visibleNodes.push_back(node);
-            if (selectedNode == node.get())
-                m_selectedItem = pos;
+            visibleNodes.push_back(node);
+            if (node->expanded && !node->nodes.empty())
+                collectVisibleNodes(node->nodes, visibleNodes);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            const float iconPadding = (m_iconBounds.x / 4.f);
-            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition(iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                   (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f));
+    bool TreeView::isNodeVisible(const Node* node) const
+    {
+        if (!node)
+            return true;
 
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
-            if (right > m_maxRight)
-                m_maxRight = right;
+        for (const Node* parent = node->parent; parent; parent = parent->parent)
+        {
+            if (!parent->expanded)
+                return false;
+        }
 
-            pos++;
-            if (node->expanded && !node->nodes.empty())
-                pos = updateVisibleNodes(node->nodes, selectedNode, textPadding, pos);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getVisibleRow(const Node* node) const
+    {
+        const auto it = std::find_if(m_visibleNodes.begin(), m_visibleNodes.end(),
+                                     [node](const std::shared_ptr<Node>& visibleNode){ return visibleNode.get() == node; });
+
+        assert(it != m_visibleNodes.end());
+        return static_cast<std::size_t>(it - m_visibleNodes.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TreeView::getRowBelowNode(const Node* node) const
+    {
+        if (!node)
+            return m_visibleNodes.size();
+
+        // When the node and all of its parents are the last child of their parent then its rows are at the end of the list.
+        // This is the case when items are added in order, which then don't need to search for the node.
+        bool lastRows = true;
+        for (const Node* ancestor = node; ancestor; ancestor = ancestor->parent)
+        {
+            const auto& siblings = ancestor->parent ? ancestor->parent->nodes : m_nodes;
+            if (siblings.back().get() != ancestor)
+            {
+                lastRows = false;
+                break;
+            }
         }
 
-        return pos;
+        if (lastRows)
+            return m_visibleNodes.size();
+
+        return getVisibleRow(node) + 1 + countVisibleChildNodes(*node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::insertVisibleNodes(std::size_t row, const std::vector<std::shared_ptr<Node>>& nodes)
+    {
+        if (nodes.empty())
+            return;
+
+        // The item below the mouse is going to change
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        m_visibleNodes.insert(m_visibleNodes.begin() + row, nodes.begin(), nodes.end());
+        if (m_selectedItem >= static_cast<int>(row))
+            m_selectedItem += static_cast<int>(nodes.size());
+
+        for (const auto& node : nodes)
+            node->text.setColor(m_textColorCached);
+
+        updateTextPositions(row, row + nodes.size());
+        updateScrollbars();
+
+        if ((oldHoveredItem >= 0) && (static_cast<std::size_t>(oldHoveredItem) < m_visibleNodes.size()))
+            updateHoveredItem(oldHoveredItem);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::removeVisibleNodes(std::size_t row, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        // The item below the mouse is going to change
+        const int oldHoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        if (m_selectedItem >= static_cast<int>(row))
+        {
+            // The selected item is deselected when it is no longer visible
+            if (m_selectedItem < static_cast<int>(row + count))
+            {
+                m_visibleNodes[m_selectedItem]->text.setColor(m_textColorCached);
+                m_selectedItem = -1;
+            }
+            else
+                m_selectedItem -= static_cast<int>(count);
+        }
+
+        bool widestRowRemoved = false;
+        for (std::size_t i = row; i < row + count; ++i)
+        {
+            if (getNodeTextRight(*m_visibleNodes[i], m_paddingCached.getRight()) >= m_maxRight)
+            {
+                widestRowRemoved = true;
+                break;
+            }
+        }
+
+        m_visibleNodes.erase(m_visibleNodes.begin() + row, m_visibleNodes.begin() + row + count);
+
+        // The texts are still positioned, only the width of the widest remaining row has to be found
+        if (widestRowRemoved)
+        {
+            m_maxRight = 0;
+            for (const auto& node : m_visibleNodes)
+                m_maxRight = std::max(m_maxRight, getNodeTextRight(*node, m_paddingCached.getRight()));
+        }
+
+        updateScrollbars();
+
+        if ((oldHoveredItem >= 0) && (static_cast<std::size_t>(oldHoveredItem) < m_visibleNodes.size()))
+            updateHoveredItem(oldHoveredItem);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateTextPositions(std::size_t firstRow, std::size_t lastRow)
+    {
+        const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        const float iconPadding = (m_iconBounds.x / 4.f);
+        for (std::size_t i = firstRow; i < lastRow; ++i)
+        {
+            auto& node = *m_visibleNodes[i];
+
+            // The vertical position of the row is only added when drawing, so inserting rows doesn't move the texts below them
+            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node.depth);
+            node.text.setPosition(iconOffset + m_iconBounds.x + iconPadding + textPadding, (m_itemHeight - node.text.getSize().y) / 2.f);
+
+            m_maxRight = std::max(m_maxRight, getNodeTextRight(node, m_paddingCached.getRight()));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1063,7 +1207,16 @@ namespace tgui
         m_hoveredItem = -1;
         m_selectedItem = -1;
         m_visibleNodes.clear();
-        updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSize), 0);
+        collectVisibleNodes(m_nodes, m_visibleNodes);
+        updateTextPositions(0, m_visibleNodes.size());
+
+        if (selectedNode)
+        {
+            const auto it = std::find_if(m_visibleNodes.begin(), m_visibleNodes.end(),
+                                         [selectedNode](const std::shared_ptr<Node>& node){ return node.get() == selectedNode; });
+            if (it != m_visibleNodes.end())
+                m_selectedItem = static_cast<int>(it - m_visibleNodes.begin());
+        }
 
         if (oldHoveredItem >= 0)
         {
@@ -1074,6 +1227,13 @@ namespace tgui
             updateSelectedAndHoveringItemColors();
         }
 
+        updateScrollbars();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::updateScrollbars()
+    {
         m_verticalScrollbar->setMaximum(static_cast<unsigned int>(m_itemHeight * m_visibleNodes.size()));
         m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxRight));
 
@@ -1105,6 +1265,8 @@ namespace tgui
 
         m_verticalScrollbar->setPosition(getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop());
         m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1179,7 +1341,7 @@ namespace tgui
                 statesForIcon.transform.translate(std::round(iconOffset), std::round((i * m_itemHeight) + ((m_itemHeight - m_iconBounds.y) / 2.f)));
 
                 // Draw an icon for the leaf node if a texture is set
-                if (m_visibleNodes[i]->nodes.empty())
+                if (m_visibleNodes[i]->nodes.empty() && !m_visibleNodes[i]->populateOnExpand)
                 {
                     if (m_spriteLeaf.isSet())
                         m_spriteLeaf.draw(target, statesForIcon);
@@ -1247,7 +1409,11 @@ namespace tgui
 
             // Draw the texts
             for (int i = firstNode; i < lastNode; ++i)
-                m_visibleNodes[i]->text.draw(target, states);
+            {
+                auto statesForText = states;
+                statesForText.transform.translate({0, static_cast<float>(i * m_itemHeight)});
+                m_visibleNodes[i]->text.draw(target, statesForText);
+            }
         }
 
         m_horizontalScrollbar->draw(target, statesForScrollbars);
@@ -1256,7 +1422,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const sf::String& text)
+    TreeView::Node* TreeView::createNode(Node* parent, const sf::String& text)
     {
         auto newNode = std::make_shared<Node>();
         newNode->text.setFont(m_fontCached);
@@ -1272,71 +1438,112 @@ namespace tgui
         else
             newNode->depth = 0;
 
+        auto& nodes = parent ? parent->nodes : m_nodes;
+        auto& nodesByText = parent ? parent->nodesByText : m_nodesByText;
+
+        // Only the first node with a certain text can be found by its hierarchy
+        nodesByText.emplace(text, newNode.get());
+
+        // The row is determined before adding the node, as the new node isn't part of the visible rows yet
+        const bool visible = !parent || (parent->expanded && isNodeVisible(parent));
+        const std::size_t row = visible ? getRowBelowNode(parent) : 0;
+
         nodes.push_back(std::move(newNode));
+        if (visible)
+            insertVisibleNodes(row, {nodes.back()});
+
+        return nodes.back().get();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool TreeView::expandOrCollapse(const std::vector<sf::String>& hierarchy, bool expandNode)
     {
-        if (hierarchy.empty())
+        auto* node = findNode(hierarchy);
+        if (!node)
             return false;
 
-        if (hierarchy.size() >= 2)
+        if (expandNode)
         {
-            auto* node = findNode(m_nodes, hierarchy, 0);
-            if (!node)
-                return false;
+            // When expanding, also expand all parents. Starting at the node itself means that its rows are only added once,
+            // when the first parent that was visible gets expanded.
+            for (auto* nodeToExpand = node; nodeToExpand; nodeToExpand = nodeToExpand->parent)
+                expandOrCollapseNode(nodeToExpand, true);
+        }
+        else // Collapsing
+            expandOrCollapseNode(node, false);
 
-            bool nodeChanged = false;
-            if (expandNode)
-            {
-                // When expanding, also expand all parents
-                auto* nodeToExpand = node;
-                while (nodeToExpand)
-                {
-                    if (nodeToExpand->expanded != expandNode)
-                    {
-                        nodeToExpand->expanded = expandNode;
-                        nodeChanged = true;
-                    }
+        return true;
+    }
 
-                    nodeToExpand = nodeToExpand->parent;
-                }
-            }
-            else // Collapsing
-            {
-                if (node->expanded != expandNode)
-                {
-                    node->expanded = expandNode;
-                    nodeChanged = true;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TreeView::expandOrCollapseNode(Node* node, bool expandNode)
+    {
+        if (node->expanded == expandNode)
+            return;
 
-            if (nodeChanged)
-                markNodesDirty();
+        if (expandNode && node->populateOnExpand)
+        {
+            node->populateOnExpand = false;
 
-            return true;
+            const std::vector<sf::String> hierarchy = getNodeHierarchy(node);
+            onPopulate.emit(this, hierarchy.back(), hierarchy);
+
+            // The callback could have expanded the node itself
+            if (node->expanded)
+                return;
         }
-        else // Root node
+
+        if (!isNodeVisible(node))
         {
-            for (auto& node : m_nodes)
-            {
-                if (node->text.getString() != hierarchy.back())
-                    continue;
+            node->expanded = expandNode;
+            return;
+        }
 
-                if (node->expanded != expandNode)
+        const std::size_t row = getVisibleRow(node) + 1;
+        if (expandNode)
+        {
+            node->expanded = true;
+
+            std::vector<std::shared_ptr<Node>> rows;
+            collectVisibleNodes(node->nodes, rows);
+            insertVisibleNodes(row, rows);
+        }
+        else
+        {
+            removeVisibleNodes(row, countVisibleChildNodes(*node));
+            node->expanded = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TreeView::removeNode(Node* node)
+    {
+        if (isNodeVisible(node))
+            removeVisibleNodes(getVisibleRow(node), 1 + countVisibleChildNodes(*node));
+
+        auto& nodes = node->parent ? node->parent->nodes : m_nodes;
+        auto& nodesByText = node->parent ? node->parent->nodesByText : m_nodesByText;
+
+        const auto indexIt = nodesByText.find(node->text.getString());
+        if ((indexIt != nodesByText.end()) && (indexIt->second == node))
+        {
+            nodesByText.erase(indexIt);
+
+            // Another node with the same text may now be the first one
+            for (const auto& sibling : nodes)
+            {
+                if ((sibling.get() != node) && (sibling->text.getString() == node->text.getString()))
                 {
-                    node->expanded = expandNode;
-                    markNodesDirty();
+                    nodesByText.emplace(sibling->text.getString(), sibling.get());
+                    break;
                 }
-
-                return true;
             }
         }
 
-        return false;
+        nodes.erase(std::find_if(nodes.begin(), nodes.end(), [node](const std::shared_ptr<Node>& child){ return child.get() == node; }));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1367,6 +1574,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_visibleNodes[m_hoveredItem]->text.setColor(m_textColorHoverCached);
         }
+
+        invalidateParentRenderCache();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1424,28 +1633,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    TreeView::Node* TreeView::findParentNode(const std::vector<sf::String>& hierarchy, unsigned int parentIndex, std::vector<std::shared_ptr<Node>>& nodes, Node* parent, bool createParents)
+    TreeView::Node* TreeView::findParentNode(const std::vector<sf::String>& hierarchy, bool createParents)
     {
-        for (auto& node : nodes)
+        Node* parent = nullptr;
+        for (std::size_t i = 0; i + 1 < hierarchy.size(); ++i)
         {
-            if (node->text.getString() != hierarchy[parentIndex])
-                continue;
-            else if (parentIndex + 2 == hierarchy.size())
-                return node.get();
+            const auto& nodesByText = parent ? parent->nodesByText : m_nodesByText;
+            const auto it = nodesByText.find(hierarchy[i]);
+            if (it != nodesByText.end())
+                parent = it->second;
+            else if (createParents)
+                parent = createNode(parent, hierarchy[i]);
             else
-                return findParentNode(hierarchy, parentIndex + 1, node->nodes, node.get(), createParents);
+                return nullptr;
         }
 
-        if (createParents)
+        return parent;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TreeView::Node* TreeView::findNode(const std::vector<sf::String>& hierarchy) const
+    {
+        Node* node = nullptr;
+        const auto* nodesByText = &m_nodesByText;
+        for (const auto& text : hierarchy)
         {
-            createNode(nodes, parent, hierarchy[parentIndex]);
-            if (parentIndex + 2 == hierarchy.size())
-                return nodes.back().get();
-            else
-                return findParentNode(hierarchy, parentIndex + 1, nodes.back()->nodes, nodes.back().get(), createParents);
+            const auto it = nodesByText->find(text);
+            if (it == nodesByText->end())
+                return nullptr;
+
+            node = it->second;
+            nodesByText = &node->nodesByText;
         }
 
-        return nullptr;
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WorkerPool.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace priv
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WorkerPool::WorkerPool(unsigned int threadCount)
+        {
+            // Leave one hardware thread for the gui by default. The hardware concurrency is 0 when it can't be determined.
+            if (threadCount == 0)
+            {
+                const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+                threadCount = (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+            }
+
+            m_threads.reserve(threadCount);
+            for (unsigned int i = 0; i < threadCount; ++i)
+                m_threads.emplace_back(&WorkerPool::run, this);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        WorkerPool::~WorkerPool()
+        {
+            std::deque<std::function<void()>> discardedJobs;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+                discardedJobs.swap(m_jobs);
+            }
+
+            m_jobAvailable.notify_all();
+            for (auto& thread : m_threads)
+                thread.join();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WorkerPool::post(std::function<void()> job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_jobs.push_back(std::move(job));
+            }
+
+            m_jobAvailable.notify_one();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WorkerPool::waitUntilIdle()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle.wait(lock, [this]{ return m_jobs.empty() && (m_runningJobs == 0); });
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t WorkerPool::getThreadCount() const
+        {
+            return m_threads.size();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void WorkerPool::run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (true)
+            {
+                m_jobAvailable.wait(lock, [this]{ return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                    return;
+
+                std::function<void()> job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+                ++m_runningJobs;
+
+                lock.unlock();
+                job();
+
+                // The job is destroyed before the pool can be considered idle, as it may own resources that the waiting thread needs
+                job = nullptr;
+                lock.lock();
+
+                --m_runningJobs;
+                if (m_jobs.empty() && (m_runningJobs == 0))
+                    m_idle.notify_all();
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
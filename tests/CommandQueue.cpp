@@ -0,0 +1,194 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Widgets/ProgressBar.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Thread.hpp>
+
+TEST_CASE("[CommandQueue]")
+{
+    SECTION("Order of execution")
+    {
+        tgui::CommandQueue queue;
+        REQUIRE(queue.getPendingCount() == 0);
+        REQUIRE(queue.execute() == 0);
+
+        std::vector<int> values;
+        queue.post([&]{ values.push_back(1); });
+        queue.post([&]{ values.push_back(2); });
+        queue.post([&]{ values.push_back(3); });
+        REQUIRE(queue.getPendingCount() == 3);
+        REQUIRE(values.empty());
+
+        REQUIRE(queue.execute() == 3);
+        REQUIRE(queue.getPendingCount() == 0);
+        REQUIRE(values == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Limited execution")
+    {
+        tgui::CommandQueue queue;
+
+        unsigned int counter = 0;
+        for (unsigned int i = 0; i < 5; ++i)
+            queue.post([&]{ ++counter; });
+
+        REQUIRE(queue.execute(2) == 2);
+        REQUIRE(counter == 2);
+        REQUIRE(queue.execute(2) == 2);
+        REQUIRE(counter == 4);
+        REQUIRE(queue.execute(2) == 1);
+        REQUIRE(counter == 5);
+
+        const auto statistics = queue.getStatistics();
+        REQUIRE(statistics.postedCommands == 5);
+        REQUIRE(statistics.executedCommands == 5);
+        REQUIRE(statistics.pendingCommands == 0);
+        REQUIRE(statistics.peakPendingCommands == 5);
+        REQUIRE(statistics.throttledExecutions == 2);
+    }
+
+    SECTION("Posting while executing")
+    {
+        tgui::CommandQueue queue;
+
+        unsigned int counter = 0;
+        std::function<void()> command = [&]{ ++counter; queue.post(command); };
+        queue.post(command);
+
+        // The command that is posted by the command itself is only executed the next time
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(counter == 1);
+        REQUIRE(queue.getPendingCount() == 1);
+        REQUIRE(queue.execute() == 1);
+        REQUIRE(counter == 2);
+    }
+
+    SECTION("Multiple threads")
+    {
+        tgui::CommandQueue queue;
+
+        const unsigned int commandsPerThread = 1000;
+        std::vector<unsigned int> counters(4, 0);
+        std::vector<std::unique_ptr<sf::Thread>> threads;
+        for (unsigned int i = 0; i < counters.size(); ++i)
+        {
+            threads.push_back(std::make_unique<sf::Thread>([&queue,&counters,i]{
+                for (unsigned int j = 0; j < commandsPerThread; ++j)
+                {
+                    // Commands from the same thread have to be executed in the same order
+                    queue.post([&counters,i,j]{
+                        if (counters[i] == j)
+                            ++counters[i];
+                    });
+                }
+            }));
+        }
+
+        for (auto& thread : threads)
+            thread->launch();
+
+        std::size_t executed = 0;
+        while (executed < counters.size() * commandsPerThread)
+            executed += queue.execute(100);
+
+        for (auto& thread : threads)
+            thread->wait();
+
+        for (const auto counter : counters)
+            REQUIRE(counter == commandsPerThread);
+
+        REQUIRE(queue.getStatistics().postedCommands == counters.size() * commandsPerThread);
+        REQUIRE(queue.getPendingCount() == 0);
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        REQUIRE(gui.getMaxCommandsPerUpdate() == 0);
+
+        auto progressBar = tgui::ProgressBar::create();
+        gui.post(progressBar, [](tgui::ProgressBar& bar){ bar.setValue(40); });
+
+        // The command isn't executed when the widget no longer exists
+        bool executed = false;
+        auto removedProgressBar = tgui::ProgressBar::create();
+        gui.post(removedProgressBar, [&](tgui::ProgressBar&){ executed = true; });
+        removedProgressBar = nullptr;
+
+        gui.setMaxCommandsPerUpdate(1);
+        REQUIRE(gui.getMaxCommandsPerUpdate() == 1);
+        gui.post([&]{ gui.setMaxCommandsPerUpdate(0); });
+
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 3);
+        REQUIRE(progressBar->getValue() == 0);
+
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(progressBar->getValue() == 40);
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 2);
+
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 1);
+        gui.updateTime(sf::milliseconds(10));
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 0);
+        REQUIRE(gui.getCommandQueueStatistics().executedCommands == 3);
+        REQUIRE(!executed);
+        REQUIRE(gui.getMaxCommandsPerUpdate() == 0);
+    }
+
+    SECTION("Gui unfocused")
+    {
+        sf::RenderTexture target;
+        target.create(50, 50);
+        tgui::Gui gui{target};
+
+        sf::Event event;
+        event.type = sf::Event::LostFocus;
+        gui.handleEvent(event);
+
+        // Commands keep being executed while the widgets aren't updated
+        unsigned int executedCount = 0;
+        gui.post([&]{ ++executedCount; });
+        gui.draw();
+        REQUIRE(executedCount == 1);
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 0);
+
+        gui.post([&]{ ++executedCount; });
+        gui.processCommands();
+        REQUIRE(executedCount == 2);
+
+        // Commands are only executed once per draw when the window is focused
+        event.type = sf::Event::GainedFocus;
+        gui.handleEvent(event);
+        gui.setMaxCommandsPerUpdate(1);
+        gui.post([&]{ ++executedCount; });
+        gui.post([&]{ ++executedCount; });
+        gui.draw();
+        REQUIRE(executedCount == 3);
+        REQUIRE(gui.getCommandQueueStatistics().pendingCommands == 1);
+    }
+}
@@ -130,6 +130,84 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("path")
+        {
+            auto child = tgui::Panel::create();
+            widget2->add(child, "inner");
+            auto grandChild = tgui::Label::create();
+            child->add(grandChild, "w1");
+
+            REQUIRE(container->getByPath("w1") == widget1);
+            REQUIRE(container->getByPath("w2.w5") == widget5);
+            REQUIRE(container->getByPath<tgui::Label>("w2.inner.w1") == grandChild);
+            REQUIRE(widget2->getByPath("inner.w1") == grandChild);
+
+            REQUIRE(container->getByPath("w5") == nullptr); // Not a direct child
+            REQUIRE(container->getByPath("w2.w1") == nullptr);
+            REQUIRE(container->getByPath("w1.w4") == nullptr); // Label is not a container
+            REQUIRE(container->getByPath("w2.inner.w1.w1") == nullptr);
+            REQUIRE(container->getByPath("") == nullptr);
+
+            widget2->setWidgetName(child, "renamed");
+            REQUIRE(container->getByPath("w2.inner.w1") == nullptr);
+            REQUIRE(container->getByPath("w2.renamed.w1") == grandChild);
+        }
+
+        SECTION("widget index")
+        {
+            REQUIRE(!container->isWidgetIndexEnabled());
+            container->setWidgetIndexEnabled(true);
+            REQUIRE(container->isWidgetIndexEnabled());
+
+            // Widgets that were added before the index was enabled are found
+            REQUIRE(container->get("w0") == nullptr);
+            REQUIRE(container->get("w1") == widget1);
+            REQUIRE(container->get("w5") == widget5);
+
+            // Widgets added to a child container are found
+            auto child = tgui::Panel::create();
+            auto grandChild = tgui::Label::create();
+            child->add(grandChild, "grandChild");
+            widget2->add(child, "child");
+            REQUIRE(container->get("child") == child);
+            REQUIRE(container->get("grandChild") == grandChild);
+
+            // Renaming a nested widget updates the index
+            REQUIRE(child->setWidgetName(grandChild, "renamed"));
+            REQUIRE(container->get("grandChild") == nullptr);
+            REQUIRE(container->get("renamed") == grandChild);
+
+            // When the same name is used multiple times, the direct children are still found first
+            auto sameName = tgui::Label::create();
+            child->add(sameName, "w1");
+            REQUIRE(container->get("w1") == widget1);
+            container->remove(widget1);
+            REQUIRE(container->get("w1") == sameName);
+
+            // Removing a container removes the widgets inside it from the index
+            container->remove(widget2);
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("child") == nullptr);
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(container->get("w1") == nullptr);
+            REQUIRE(widget2->get("renamed") == grandChild);
+
+            container->add(widget2, "w2");
+            REQUIRE(container->get("renamed") == grandChild);
+
+            widget2->removeAllWidgets();
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(container->get("w2") == widget2);
+
+            container->removeAllWidgets();
+            REQUIRE(container->get("w2") == nullptr);
+            REQUIRE(container->get("w3") == nullptr);
+
+            container->setWidgetIndexEnabled(false);
+            REQUIRE(!container->isWidgetIndexEnabled());
+        }
     }
 
     SECTION("remove")
@@ -265,6 +343,309 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Render cache")
+    {
+        sf::RenderTexture target;
+        target.create(200, 150);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({180, 130});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor({200, 200, 200});
+        gui.add(panel);
+        REQUIRE(!panel->isRenderCacheEnabled());
+
+        // Button that counts how many times it was drawn
+        struct CountingButton : public tgui::Button
+        {
+            void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+            {
+                ++drawCount;
+                tgui::Button::draw(target, states);
+            }
+
+            mutable unsigned int drawCount = 0;
+        };
+
+        std::vector<std::shared_ptr<CountingButton>> buttons;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            auto button = std::make_shared<CountingButton>();
+            button->setText("Button" + tgui::to_string(i));
+            button->setPosition({10, 10 + i * 35.f});
+            button->setSize({80, 30});
+            button->getRenderer()->setBackgroundColor({255, 255, 255, 150});
+            panel->add(button);
+            buttons.push_back(button);
+        }
+
+        const auto drawGui = [&](const std::string& filename){
+            target.clear({25, 130, 10});
+            gui.draw();
+            target.display();
+            target.getTexture().copyToImage().saveToFile(filename);
+        };
+
+        drawGui("Container_RenderCache_Uncached1.png");
+        const unsigned int uncachedDrawCalls = gui.getDrawCallCount();
+
+        panel->setRenderCacheEnabled(true);
+        REQUIRE(panel->isRenderCacheEnabled());
+
+        // The first draw fills the cache, the second one reuses it
+        drawGui("Container_RenderCache_Cached1.png");
+        REQUIRE(buttons[0]->drawCount == 2);
+        drawGui("Container_RenderCache_Cached1.png");
+        REQUIRE(buttons[0]->drawCount == 2);
+        REQUIRE(gui.getDrawCallCount() < uncachedDrawCalls);
+        compareImageFiles("Container_RenderCache_Cached1.png", "Container_RenderCache_Uncached1.png");
+
+        // Changing a child widget has to update the cached image, also when only its contents change
+        buttons[1]->setPosition({50, 60});
+        buttons[2]->getRenderer()->setTextColor(sf::Color::Red);
+        buttons[0]->setText("Changed");
+        drawGui("Container_RenderCache_Cached2.png");
+        REQUIRE(buttons[0]->drawCount == 3);
+
+        // Moving the mouse only causes a redraw when a child widget looks different afterwards
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 30;
+        event.mouseMove.y = 30;
+        gui.handleEvent(event);
+        drawGui("Container_RenderCache_Hover.png");
+        REQUIRE(buttons[0]->drawCount == 4);
+
+        event.mouseMove.x = 40;
+        gui.handleEvent(event);
+        drawGui("Container_RenderCache_Hover.png");
+        REQUIRE(buttons[0]->drawCount == 4);
+
+        // Events that don't reach any widget don't cause a redraw either
+        event.type = sf::Event::KeyPressed;
+        event.key.code = sf::Keyboard::Space;
+        event.key.alt = false;
+        event.key.control = false;
+        event.key.shift = false;
+        event.key.system = false;
+        gui.handleEvent(event);
+        drawGui("Container_RenderCache_Hover.png");
+        REQUIRE(buttons[0]->drawCount == 4);
+
+        // Pressing the mouse on the button does change how it looks
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = 40;
+        event.mouseButton.y = 30;
+        gui.handleEvent(event);
+        drawGui("Container_RenderCache_Hover.png");
+        REQUIRE(buttons[0]->drawCount == 5);
+
+        event.type = sf::Event::MouseButtonReleased;
+        gui.handleEvent(event);
+
+        panel->setRenderCacheEnabled(false);
+        drawGui("Container_RenderCache_Uncached2.png");
+        compareImageFiles("Container_RenderCache_Cached2.png", "Container_RenderCache_Uncached2.png");
+
+        // The texture is sized in pixels, so the cached image is as sharp as the uncached one when the view is zoomed in
+        gui.setView(sf::View{{0, 0, 100, 75}});
+        drawGui("Container_RenderCache_Uncached3.png");
+        panel->setRenderCacheEnabled(true);
+        drawGui("Container_RenderCache_Cached3.png");
+        compareImageFiles("Container_RenderCache_Cached3.png", "Container_RenderCache_Uncached3.png");
+        panel->setRenderCacheEnabled(false);
+
+        // Copying a container keeps the setting but not the cached image
+        auto panelCopy = tgui::Panel::copy(panel);
+        REQUIRE(!panelCopy->isRenderCacheEnabled());
+        panel->setRenderCacheEnabled(true);
+        panelCopy = tgui::Panel::copy(panel);
+        REQUIRE(panelCopy->isRenderCacheEnabled());
+    }
+
+    SECTION("drawWidgetContainer")
+    {
+        // Panel that counts how many times it drew its children
+        struct CountingPanel : public tgui::Panel
+        {
+            void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const override
+            {
+                ++drawCount;
+                tgui::Panel::drawWidgetContainer(target, states);
+            }
+
+            mutable unsigned int drawCount = 0;
+        };
+
+        sf::RenderTexture target;
+        target.create(200, 150);
+        tgui::Gui gui{target};
+
+        auto panel = std::make_shared<CountingPanel>();
+        panel->add(tgui::Button::create("Button"));
+        gui.add(panel);
+
+        // Containers draw their children with drawWidgetContainer, also when the render cache is used
+        gui.draw();
+        REQUIRE(panel->drawCount == 1);
+
+        panel->setRenderCacheEnabled(true);
+        gui.draw();
+        REQUIRE(panel->drawCount == 2);
+        gui.draw();
+        REQUIRE(panel->drawCount == 2);
+    }
+
+    SECTION("Spatial index")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+        REQUIRE(!panel->isSpatialIndexEnabled());
+
+        std::vector<tgui::Button::Ptr> buttons;
+        for (unsigned int y = 0; y < 10; ++y)
+        {
+            for (unsigned int x = 0; x < 10; ++x)
+            {
+                auto button = tgui::Button::create();
+                button->setPosition({x * 40.f, y * 30.f});
+                button->setSize({40, 30});
+                panel->add(button);
+                buttons.push_back(button);
+            }
+        }
+
+        auto overlappingButton = tgui::Button::create();
+        overlappingButton->setPosition({30, 20});
+        overlappingButton->setSize({60, 50});
+        panel->add(overlappingButton);
+
+        tgui::Widget* pressedWidget = nullptr;
+        for (auto& button : buttons)
+        {
+            tgui::Widget* widget = button.get();
+            button->onMousePress.connect([&pressedWidget,widget]{ pressedWidget = widget; });
+        }
+        overlappingButton->onMousePress.connect([&]{ pressedWidget = overlappingButton.get(); });
+
+        const auto click = [&](tgui::Vector2f pos){
+            pressedWidget = nullptr;
+            panel->leftMousePressed(pos);
+            panel->leftMouseReleased(pos);
+            panel->leftMouseButtonNoLongerDown();
+            return pressedWidget;
+        };
+
+        const auto testClicks = [&]{
+            REQUIRE(click({5, 5}) == buttons[0].get());
+            REQUIRE(click({395, 295}) == buttons[99].get());
+            REQUIRE(click({45, 25}) == overlappingButton.get());
+            REQUIRE(click({500, 500}) == nullptr);
+
+            overlappingButton->moveToBack();
+            REQUIRE(click({45, 25}) == buttons[1].get());
+            REQUIRE(click({85, 65}) == buttons[22].get());
+
+            overlappingButton->moveToFront();
+            REQUIRE(click({45, 25}) == overlappingButton.get());
+
+            // Place the button between the other buttons
+            REQUIRE(panel->setWidgetIndex(overlappingButton, 2));
+            REQUIRE(click({45, 25}) == overlappingButton.get());
+            REQUIRE(click({85, 65}) == buttons[22].get());
+            REQUIRE(panel->setWidgetIndex(overlappingButton, 0));
+            REQUIRE(click({45, 25}) == buttons[1].get());
+            REQUIRE(!panel->setWidgetIndex(overlappingButton, 101));
+            REQUIRE(panel->setWidgetIndex(overlappingButton, 100));
+            REQUIRE(click({45, 25}) == overlappingButton.get());
+
+            // Disabled widgets still hide the widgets behind them
+            overlappingButton->setEnabled(false);
+            REQUIRE(click({45, 25}) == nullptr);
+            overlappingButton->setEnabled(true);
+
+            // Invisible widgets don't
+            overlappingButton->setVisible(false);
+            REQUIRE(click({45, 25}) == buttons[1].get());
+            overlappingButton->setVisible(true);
+
+            overlappingButton->setPosition({200, 150});
+            REQUIRE(click({45, 25}) == buttons[1].get());
+            REQUIRE(click({255, 195}) == overlappingButton.get());
+
+            overlappingButton->setSize({150, 100});
+            REQUIRE(click({345, 245}) == overlappingButton.get());
+
+            panel->remove(overlappingButton);
+            REQUIRE(click({255, 195}) == buttons[66].get());
+
+            panel->add(overlappingButton);
+            overlappingButton->setPosition({30, 20});
+            overlappingButton->setSize({60, 50});
+        };
+
+        // The results have to be the same with and without the index
+        testClicks();
+
+        panel->setSpatialIndexEnabled(true);
+        REQUIRE(panel->isSpatialIndexEnabled());
+        testClicks();
+
+        panel->setSpatialIndexEnabled(true, 1000);
+        testClicks();
+
+        panel->setSpatialIndexEnabled(true, 7);
+        testClicks();
+
+        auto panelCopy = tgui::Panel::copy(panel);
+        REQUIRE(panelCopy->isSpatialIndexEnabled());
+
+        panel->setSpatialIndexEnabled(false);
+        REQUIRE(!panel->isSpatialIndexEnabled());
+        testClicks();
+    }
+
+    SECTION("Spatial index with resizable child window")
+    {
+        auto panel = tgui::Panel::create({400, 300});
+        panel->setSpatialIndexEnabled(true, 64);
+
+        // The left border of the window lies exactly on the border between two cells
+        auto childWindow = tgui::ChildWindow::create();
+        childWindow->setPosition({128, 128});
+        childWindow->setSize({100, 80});
+        childWindow->getRenderer()->setBorders({1});
+        childWindow->getRenderer()->setMinimumResizableBorderWidth(5);
+        childWindow->setResizable(true);
+        panel->add(childWindow);
+
+        unsigned int pressCount = 0;
+        childWindow->onMousePress.connect([&]{ ++pressCount; });
+
+        const auto click = [&](tgui::Vector2f pos){
+            panel->leftMousePressed(pos);
+            panel->leftMouseReleased(pos);
+            panel->leftMouseButtonNoLongerDown();
+        };
+
+        // The resize border can be clicked from outside the window
+        click({126, 170});
+        REQUIRE(pressCount == 1);
+        REQUIRE(childWindow->getPosition() == tgui::Vector2f{128, 128});
+
+        childWindow->setResizable(false);
+        click({126, 170});
+        REQUIRE(pressCount == 1);
+
+        childWindow->setResizable(true);
+        click({126, 170});
+        REQUIRE(pressCount == 2);
+
+        childWindow->getRenderer()->setMinimumResizableBorderWidth(1);
+        click({126, 170});
+        REQUIRE(pressCount == 2);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
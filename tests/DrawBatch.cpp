@@ -0,0 +1,139 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[DrawBatch]")
+{
+    SECTION("Enabling and disabling")
+    {
+        tgui::DrawBatch batch;
+        REQUIRE(!batch.isBatchingEnabled());
+        REQUIRE(batch.getDrawCallCount() == 0);
+
+        batch.setBatchingEnabled(true);
+        REQUIRE(batch.isBatchingEnabled());
+
+        batch.setBatchingEnabled(false);
+        REQUIRE(!batch.isBatchingEnabled());
+
+        tgui::Gui gui;
+        REQUIRE(!gui.isDrawBatchingEnabled());
+        gui.setDrawBatchingEnabled(true);
+        REQUIRE(gui.isDrawBatchingEnabled());
+    }
+
+    SECTION("Draw calls")
+    {
+        sf::RenderTexture target;
+        target.create(200, 150);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({180, 130});
+        panel->setPosition({10, 10});
+        panel->getRenderer()->setBackgroundColor({200, 200, 200});
+        gui.add(panel);
+
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            auto button = tgui::Button::create("Button" + tgui::to_string(i));
+            button->setPosition({10, 10 + i * 35.f});
+            button->setSize({80, 30});
+            panel->add(button);
+
+            auto checkBox = tgui::CheckBox::create();
+            checkBox->setPosition({100, 15 + i * 35.f});
+            checkBox->setChecked(i % 2 == 0);
+            panel->add(checkBox);
+        }
+
+        auto label = tgui::Label::create("Label");
+        label->setPosition({130, 115});
+        gui.add(label);
+
+        REQUIRE(gui.getDrawCallCount() == 0);
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("DrawBatch_Unbatched.png");
+        const unsigned int unbatchedDrawCalls = gui.getDrawCallCount();
+        REQUIRE(unbatchedDrawCalls > 0);
+
+        gui.setDrawBatchingEnabled(true);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("DrawBatch_Batched.png");
+        const unsigned int batchedDrawCalls = gui.getDrawCallCount();
+        REQUIRE(batchedDrawCalls > 0);
+        REQUIRE(batchedDrawCalls < unbatchedDrawCalls);
+
+        // The draw call counter is reset every time the gui is drawn
+        target.clear({25, 130, 10});
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() == batchedDrawCalls);
+
+        compareImageFiles("DrawBatch_Batched.png", "DrawBatch_Unbatched.png");
+    }
+
+    SECTION("Clipping")
+    {
+        auto panel = tgui::Panel::create({40, 30});
+        panel->setPosition(395, 305);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Green);
+
+        auto clippedPanel = tgui::Panel::create({200, 200});
+        clippedPanel->setPosition(-50, -50);
+        clippedPanel->getRenderer()->setBackgroundColor({255, 0, 0, 100});
+        panel->add(clippedPanel);
+
+        TEST_DRAW_INIT(80, 80, panel)
+        gui.setDrawBatchingEnabled(true);
+
+        auto background = tgui::Panel::create();
+        background->setSize({800, 600});
+        background->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        gui.add(background);
+        background->moveToBack();
+
+        sf::View view = gui.getView();
+        view.setViewport({0.1f, 0.2f, 0.8f, 0.6f});
+        view.setCenter(415, 320);
+        view.setSize(80, 40);
+        gui.setView(view);
+
+        // Batching must not change what ends up on the screen
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("DrawBatch_Clipping.png");
+        compareImageFiles("DrawBatch_Clipping.png", "expected/Clipping_Panel.png");
+    }
+}
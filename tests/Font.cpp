@@ -35,4 +35,39 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Cache")
+    {
+        tgui::Font::clearFontCache();
+        REQUIRE(tgui::Font::getCachedFontCount() == 0);
+        REQUIRE(tgui::Font::getFontCacheMemoryUsage() == 0);
+
+        tgui::Font fontA("resources/DejaVuSans.ttf");
+        REQUIRE(tgui::Font::getFontCacheMissCount() == 1);
+        REQUIRE(tgui::Font::getFontCacheHitCount() == 0);
+        REQUIRE(tgui::Font::getCachedFontCount() == 1);
+        REQUIRE(tgui::Font::getFontCacheMemoryUsage() > 0);
+
+        // Every user of the same file shares the same font
+        for (unsigned int i = 0; i < 40; ++i)
+            REQUIRE(tgui::Font("resources/DejaVuSans.ttf") == fontA);
+
+        REQUIRE(tgui::Font::getFontCacheMissCount() == 1);
+        REQUIRE(tgui::Font::getFontCacheHitCount() == 40);
+        REQUIRE(tgui::Font::getCachedFontCount() == 1);
+
+        // The font is removed from the cache once nobody uses it anymore
+        fontA = nullptr;
+        REQUIRE(tgui::Font::getCachedFontCount() == 0);
+
+        tgui::Font fontB("resources/DejaVuSans.ttf");
+        REQUIRE(tgui::Font::getFontCacheMissCount() == 2);
+
+        // Fonts that are still in use remain valid after clearing the cache, but they are no longer shared
+        tgui::Font::clearFontCache();
+        REQUIRE(tgui::Font::getFontCacheMissCount() == 0);
+        REQUIRE(tgui::Font::getFontCacheLoadTime() == sf::Time::Zero);
+        REQUIRE(fontB.getFont() != nullptr);
+        REQUIRE(tgui::Font("resources/DejaVuSans.ttf") != fontB);
+    }
 }
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/HeightIndex.hpp>
+
+TEST_CASE("[HeightIndex]")
+{
+    tgui::priv::HeightIndex index;
+    REQUIRE(index.getSize() == 0);
+    REQUIRE(index.getTotalHeight() == 0);
+    REQUIRE(index.findIndex(10) == 0);
+
+    SECTION("Adding and removing at both ends")
+    {
+        index.pushBack(10);
+        index.pushBack(20);
+        index.pushFront(5);
+        REQUIRE(index.getSize() == 3);
+        REQUIRE(index.getTotalHeight() == 35);
+        REQUIRE(index.getHeight(0) == 5);
+        REQUIRE(index.getPosition(0) == 0);
+        REQUIRE(index.getPosition(1) == 5);
+        REQUIRE(index.getPosition(2) == 15);
+        REQUIRE(index.getPosition(3) == 35);
+
+        index.popFront();
+        REQUIRE(index.getTotalHeight() == 30);
+        REQUIRE(index.getPosition(1) == 10);
+
+        index.popBack();
+        REQUIRE(index.getSize() == 1);
+        REQUIRE(index.getTotalHeight() == 10);
+
+        index.clear();
+        REQUIRE(index.getSize() == 0);
+        REQUIRE(index.getTotalHeight() == 0);
+    }
+
+    SECTION("Finding items")
+    {
+        index.assign({10, 0, 20, 30});
+        REQUIRE(index.findIndex(-5) == 0);
+        REQUIRE(index.findIndex(0) == 0);
+        REQUIRE(index.findIndex(9.5f) == 0);
+        REQUIRE(index.findIndex(10) == 2);
+        REQUIRE(index.findIndex(29) == 2);
+        REQUIRE(index.findIndex(30) == 3);
+        REQUIRE(index.findIndex(59) == 3);
+        REQUIRE(index.findIndex(60) == 4);
+    }
+
+    SECTION("Many items")
+    {
+        // Keep a fixed amount of items while adding many, like a chat box with a line limit
+        for (unsigned int i = 0; i < 10000; ++i)
+        {
+            index.pushBack(static_cast<float>(i % 3));
+            if (index.getSize() > 100)
+                index.popFront();
+        }
+
+        REQUIRE(index.getSize() == 100);
+        REQUIRE(index.getTotalHeight() == 99);
+        REQUIRE(index.getHeight(0) == 0);
+        REQUIRE(index.getPosition(50) == 49);
+        REQUIRE(index.findIndex(50) == 50);
+
+        index.erase(1, 98);
+        REQUIRE(index.getSize() == 2);
+        REQUIRE(index.getTotalHeight() == 0);
+    }
+}
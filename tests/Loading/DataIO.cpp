@@ -206,6 +206,30 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("parse from memory")
+    {
+        const std::string input = "Child {\n    Property = Value; // Comment\n    List = [a, \"b, c\"];\n}\n";
+        auto root = tgui::DataIO::parse(input.data(), input.size());
+        REQUIRE(root->children.size() == 1);
+        REQUIRE(root->children[0]->propertyValuePairs["property"]->value == "Value");
+        REQUIRE(root->children[0]->propertyValuePairs["list"]->valueList.size() == 2);
+        REQUIRE(root->children[0]->propertyValuePairs["list"]->valueList[1] == "\"b, c\"");
+
+        // The stream is parsed starting from the part that wasn't read yet
+        std::stringstream stream{"Ignored " + input};
+        std::string ignoredWord;
+        stream >> ignoredWord;
+        std::stringstream emittedFromMemory;
+        std::stringstream emittedFromStream;
+        tgui::DataIO::emit(root, emittedFromMemory);
+        tgui::DataIO::emit(tgui::DataIO::parse(stream), emittedFromStream);
+        REQUIRE(emittedFromStream.str() == emittedFromMemory.str());
+
+        const std::string invalidInput = "Child {\n    Property = Value;\n    = Value;\n}\n";
+        REQUIRE_THROWS_WITH(tgui::DataIO::parse(invalidInput.data(), invalidInput.size()),
+                            Catch::Contains("at line 3"));
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
@@ -293,4 +317,78 @@ TEST_CASE("[DataIO]")
         REQUIRE(parsedRoot->children[1]->children.empty());
         REQUIRE(parsedRoot->children[1]->propertyValuePairs.empty());
     }
+
+    SECTION("stream writer")
+    {
+        std::stringstream input("GlobalProperty = GlobalValue;"
+                                "Child1 { Property = Value; NestedChild1 { A = 1; } NestedChild2 { List = [X, Y]; } }"
+                                "{ EmptyName = 1; }"
+                                "Child3 {}");
+        auto root = tgui::DataIO::parse(input);
+
+        std::stringstream emitted;
+        tgui::DataIO::emit(root, emitted);
+
+        // Writing the sections one by one gives the same result as emitting the whole tree at once
+        std::stringstream written;
+        tgui::DataIO::StreamWriter writer{written};
+        writer.writeProperty("globalproperty", "GlobalValue");
+        for (const auto& child : root->children)
+            writer.writeSection(*child);
+
+        REQUIRE(written.str() == emitted.str());
+        REQUIRE(written.str() == "globalproperty = GlobalValue;\n"
+                                 "\n"
+                                 "Child1 {\n"
+                                 "    property = Value;\n"
+                                 "\n"
+                                 "    NestedChild1 {\n"
+                                 "        a = 1;\n"
+                                 "    }\n"
+                                 "\n"
+                                 "    NestedChild2 {\n"
+                                 "        list = [X, Y];\n"
+                                 "    }\n"
+                                 "}\n"
+                                 "\n"
+                                 "{\n"
+                                 "    emptyname = 1;\n"
+                                 "}\n"
+                                 "\n"
+                                 "Child3 {\n"
+                                 "}\n");
+    }
+
+    SECTION("binary")
+    {
+        std::stringstream input("GlobalProperty = GlobalValue;"
+                                "Child1 { Property = \"Value\"; NestedChild { List = [X, \"Y\", Z]; } }"
+                                "Child2 { Property = \"Value\"; }");
+        auto root = tgui::DataIO::parse(input);
+
+        std::stringstream binaryStream;
+        tgui::DataIO::emitBinary(root, binaryStream);
+        const std::string binary = binaryStream.str();
+        REQUIRE(tgui::DataIO::isBinary(binary.data(), binary.size()));
+        REQUIRE(!tgui::DataIO::isBinary(input.str().data(), input.str().size()));
+
+        auto parsedRoot = tgui::DataIO::parseBinary(binary.data(), binary.size());
+        REQUIRE(parsedRoot->children.size() == 2);
+        REQUIRE(parsedRoot->children[0]->children[0]->parent == parsedRoot->children[0].get());
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["list"]->listNode);
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["list"]->valueList.size() == 3);
+        REQUIRE(parsedRoot->children[0]->children[0]->propertyValuePairs["list"]->valueList[1] == "\"Y\"");
+
+        // The binary file contains exactly the same tree as the text file
+        std::stringstream originalText;
+        std::stringstream parsedText;
+        tgui::DataIO::emit(root, originalText);
+        tgui::DataIO::emit(parsedRoot, parsedText);
+        REQUIRE(parsedText.str() == originalText.str());
+
+        // Damaged files are rejected instead of being read outside the data
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(binary.data(), binary.size() - 1), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(binary.data(), 20), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(input.str().data(), input.str().size()), tgui::Exception);
+    }
 }
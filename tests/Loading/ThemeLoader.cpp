@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <fstream>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -35,6 +37,7 @@ namespace tgui
     struct DefaultThemeLoaderTest
     {
         static auto& getPropertiesCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_propertiesCache; }
+        static auto& getRenderersCache(std::shared_ptr<DefaultThemeLoader> loader) { return loader->m_renderersCache; }
     };
 }
 
@@ -110,50 +113,122 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
     }
 
+    SECTION("load renderer")
+    {
+        auto renderer = loader->loadRenderer("resources/ThemeNested.txt", "ListBox1");
+        REQUIRE(renderer->propertyValuePairs.size() == 2);
+        REQUIRE(renderer->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::White);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs.size() == 2);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        renderer = loader->loadRenderer("resources/ThemeNested.txt", "ListBox3");
+        REQUIRE(renderer->propertyValuePairs.size() == 1);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(renderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Yellow);
+
+        renderer = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox4");
+        auto listBoxRenderer = renderer->propertyValuePairs["listbox"].getRenderer();
+        REQUIRE(listBoxRenderer->propertyValuePairs.size() == 2);
+        REQUIRE(listBoxRenderer->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["thumbcolor"].getColor() == sf::Color::Green);
+
+        // Every call returns a copy, including the nested renderers
+        auto renderer1 = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox1");
+        auto renderer2 = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox1");
+        REQUIRE(renderer1 != renderer2);
+        REQUIRE(renderer1->propertyValuePairs["listbox"].getRenderer() != renderer2->propertyValuePairs["listbox"].getRenderer());
+        renderer1->propertyValuePairs["listbox"].getRenderer()->propertyValuePairs["backgroundcolor"] = sf::Color::Red;
+        REQUIRE(renderer2->propertyValuePairs["listbox"].getRenderer()->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::White);
+        REQUIRE(loader->loadRenderer("resources/ThemeNested.txt", "ComboBox1")->propertyValuePairs["listbox"].getRenderer()
+                    ->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::White);
+
+        REQUIRE(loader->loadRenderer("", "Button")->propertyValuePairs.empty());
+        REQUIRE_THROWS_AS(loader->loadRenderer("resources/ThemeNested.txt", "NonexistentClassName"), tgui::Exception);
+    }
+
+    SECTION("load binary theme")
+    {
+        std::ifstream textFile{"resources/ThemeNested.txt", std::ios::binary};
+        std::stringstream textStream;
+        textStream << textFile.rdbuf();
+        const std::string text = textStream.str();
+
+        {
+            std::ofstream binaryFile{"ThemeNestedBinary.txt", std::ios::binary};
+            tgui::DataIO::emitBinary(tgui::DataIO::parse(text.data(), text.size()), binaryFile);
+        }
+
+        auto renderer = loader->loadRenderer("ThemeNestedBinary.txt", "ComboBox4");
+        auto listBoxRenderer = renderer->propertyValuePairs["listbox"].getRenderer();
+        REQUIRE(listBoxRenderer->propertyValuePairs["backgroundcolor"].getColor() == sf::Color::Magenta);
+        REQUIRE(listBoxRenderer->propertyValuePairs["scrollbar"].getRenderer()->propertyValuePairs["trackcolor"].getColor() == sf::Color::Red);
+
+        REQUIRE(loader->load("ThemeNestedBinary.txt", "ComboBox4") == loader->load("resources/ThemeNested.txt", "ComboBox4"));
+    }
+
+    SECTION("texture ids")
+    {
+        REQUIRE(loader->getTextureIds("resources/Black.txt") == std::vector<sf::String>{"resources/Black.png"});
+        REQUIRE(loader->getTextureIds("resources/ThemeComments.txt").empty());
+        REQUIRE(loader->getTextureIds("").empty());
+    }
+
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
+        REQUIRE(tgui::DefaultThemeLoaderTest::getRenderersCache(loader).size() == 0);
 
         SECTION("with preload")
         {
             loader->preload("resources/ThemeSpecialCases.txt");
             loader->preload("resources/ThemeButton1.txt");
 
-            auto& propertyCache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader);
-            REQUIRE(propertyCache.size() == 2);
+            auto& renderersCache = tgui::DefaultThemeLoaderTest::getRenderersCache(loader);
+            REQUIRE(renderersCache.size() == 2);
 
-            auto& cache1 = propertyCache["resources/ThemeSpecialCases.txt"];
-            auto& cache2 = propertyCache["resources/ThemeButton1.txt"];
+            auto& cache1 = renderersCache["resources/ThemeSpecialCases.txt"];
+            auto& cache2 = renderersCache["resources/ThemeButton1.txt"];
             REQUIRE(cache1.size() == 4);
-            REQUIRE(cache1["button1"].size() == 1);
-            REQUIRE(cache1["button1"]["textcolor"] == "rgb(255, 0, 0)");
-            REQUIRE(cache1["name.with.dots"].size() == 2);
-            REQUIRE(cache1["name.with.dots"]["textcolor"] == "rgb(0, 255, 0)");
-            REQUIRE(cache1["name.with.dots"]["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""].size() == 1);
-            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]["textcolor"] == "rgba(,,,)");
-            REQUIRE(cache1["label"].size() == 1);
-            REQUIRE(cache1["label"]["textcolor"] == "rgb(0, 0, 255)");
+            REQUIRE(cache1["button1"]->propertyValuePairs.size() == 1);
+            REQUIRE(cache1["button1"]->propertyValuePairs["textcolor"].getString() == "rgb(255, 0, 0)");
+            REQUIRE(cache1["name.with.dots"]->propertyValuePairs.size() == 2);
+            REQUIRE(cache1["name.with.dots"]->propertyValuePairs["textcolor"].getString() == "rgb(0, 255, 0)");
+            REQUIRE(cache1["name.with.dots"]->propertyValuePairs["backgroundcolor"].getString() == "rgb(255, 255, 255)");
+            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]->propertyValuePairs.size() == 1);
+            REQUIRE(cache1["specialchars.{}=:;/*#//\t\\\""]->propertyValuePairs["textcolor"].getString() == "rgba(,,,)");
+            REQUIRE(cache1["label"]->propertyValuePairs.size() == 1);
+            REQUIRE(cache1["label"]->propertyValuePairs["textcolor"].getString() == "rgb(0, 0, 255)");
             REQUIRE(cache2.size() == 1);
-            REQUIRE(cache2["button1"].size() == 1);
-            REQUIRE(cache2["button1"]["textcolor"] == "rgb(255, 255, 0)");
+            REQUIRE(cache2["button1"]->propertyValuePairs.size() == 1);
+            REQUIRE(cache2["button1"]->propertyValuePairs["textcolor"].getString() == "rgb(255, 255, 0)");
+
+            // The property-value pairs are only serialized when they are requested
+            auto& propertyCache = tgui::DefaultThemeLoaderTest::getPropertiesCache(loader);
+            REQUIRE(propertyCache.size() == 0);
 
             auto properties = loader->load("resources/ThemeSpecialCases.txt", "name.WITH.dots");
             REQUIRE(properties.size() == 2);
             REQUIRE(properties["textcolor"] == "rgb(0, 255, 0)");
             REQUIRE(properties["backgroundcolor"] == "rgb(255, 255, 255)");
-            REQUIRE(propertyCache.size() == 2);
+            REQUIRE(renderersCache.size() == 2);
+            REQUIRE(propertyCache.size() == 1);
 
             properties = loader->load("resources/ThemeButton1.txt", "Button1");
+            REQUIRE(renderersCache.size() == 2);
             REQUIRE(propertyCache.size() == 2);
 
             properties = loader->load("resources/Black.txt", "EditBox");
+            REQUIRE(renderersCache.size() == 3);
             REQUIRE(propertyCache.size() == 3);
 
             tgui::DefaultThemeLoader::flushCache("resources/ThemeButton1.txt");
+            REQUIRE(renderersCache.size() == 2);
             REQUIRE(propertyCache.size() == 2);
 
             tgui::DefaultThemeLoader::flushCache();
+            REQUIRE(renderersCache.size() == 0);
             REQUIRE(propertyCache.size() == 0);
         }
 
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Sprite.hpp>
+#include <TGUI/TextureManager.hpp>
 
 TEST_CASE("[Sprite]")
 {
@@ -131,6 +132,25 @@ TEST_CASE("[Sprite]")
             REQUIRE(!sprite.isTransparentPixel({69, 20}));
         }
 
+        SECTION("Alpha mask instead of image")
+        {
+            tgui::TextureManager::setKeepImagesAfterUpload(false);
+            sprite.setTexture({"resources/TransparentParts.png", {10, 10, 30, 30}});
+            tgui::TextureManager::setKeepImagesAfterUpload(true);
+
+            REQUIRE(sprite.getTexture().getData()->image == nullptr);
+            REQUIRE(sprite.getTexture().getData()->alphaMask.size() == 30 * 30);
+
+            sprite.setSize({60, 15});
+            REQUIRE(!sprite.isTransparentPixel({21, 22.5f}));
+            REQUIRE(sprite.isTransparentPixel({22, 23}));
+            REQUIRE(!sprite.isTransparentPixel({58, 32}));
+            REQUIRE(sprite.isTransparentPixel({57, 31.5f}));
+            REQUIRE(sprite.isTransparentPixel({40, 27.5f}));
+            REQUIRE(!sprite.isTransparentPixel({10, 20}));
+            REQUIRE(!sprite.isTransparentPixel({69, 34.5f}));
+        }
+
         SECTION("Horizontal Scaling")
         {
             sprite.setTexture({"resources/TransparentParts.png", {0, 10, 50, 30}, {10, 0, 30, 30}});
@@ -501,6 +521,69 @@ TEST_CASE("[Sprite]")
         }
     }
 
+    SECTION("Sprites with the same svg image share the rasterized texture")
+    {
+        tgui::TextureManager::clearSvgCache();
+        const std::size_t oldLimit = tgui::TextureManager::getSvgCacheLimit();
+        const std::size_t oldHitCount = tgui::TextureManager::getSvgCacheHitCount();
+        const std::size_t oldMissCount = tgui::TextureManager::getSvgCacheMissCount();
+
+        tgui::Texture texture{"resources/SFML.svg"};
+        tgui::Sprite sprite1{texture};
+        tgui::Sprite sprite2{texture};
+        REQUIRE(tgui::TextureManager::getSvgCacheMissCount() == oldMissCount + 1);
+        REQUIRE(tgui::TextureManager::getSvgCacheHitCount() == oldHitCount + 1);
+
+        sprite1.setSize({50, 40});
+        sprite2.setSize({50, 40});
+        REQUIRE(tgui::TextureManager::getSvgCacheMissCount() == oldMissCount + 2);
+        REQUIRE(tgui::TextureManager::getSvgCacheHitCount() == oldHitCount + 2);
+        REQUIRE(tgui::TextureManager::getSvgCacheMemoryUsage() == (130 * 130 + 50 * 40) * 4);
+
+        // Only the texture that is no longer used by any sprite can be removed
+        tgui::TextureManager::setSvgCacheLimit(0);
+        REQUIRE(tgui::TextureManager::getSvgCacheLimit() == 0);
+        REQUIRE(tgui::TextureManager::getSvgCacheMemoryUsage() == 50 * 40 * 4);
+
+        tgui::TextureManager::setSvgCacheLimit(oldLimit);
+        tgui::TextureManager::clearSvgCache();
+        REQUIRE(tgui::TextureManager::getSvgCacheMemoryUsage() == 0);
+    }
+
+    SECTION("Asynchronous svg rasterization")
+    {
+        tgui::TextureManager::clearSvgCache();
+        tgui::TextureManager::setAsyncSvgRasterizationEnabled(true);
+        REQUIRE(tgui::TextureManager::isAsyncSvgRasterizationEnabled());
+
+        std::vector<sf::Vector2u> rasterizedSizes;
+        tgui::TextureManager::setSvgRasterizationCallback([&](sf::Vector2u size, sf::Time rasterizationTime, sf::Time latency){
+                REQUIRE(latency >= rasterizationTime);
+                rasterizedSizes.push_back(size);
+            });
+
+        tgui::Sprite svgSprite{"resources/SFML.svg"};
+        REQUIRE(tgui::TextureManager::processPendingUploads(true) == 1);
+        REQUIRE(rasterizedSizes == std::vector<sf::Vector2u>{{130, 130}});
+
+        // The texture for the new size stays empty until the pixels are uploaded
+        svgSprite.setSize({50, 40});
+        REQUIRE(tgui::TextureManager::getSvgCacheMemoryUsage() == (130 * 130 + 50 * 40) * 4);
+        REQUIRE(tgui::TextureManager::processPendingUploads(true) == 1);
+        REQUIRE(rasterizedSizes.size() == 2);
+        REQUIRE(rasterizedSizes[1] == sf::Vector2u{50, 40});
+
+        tgui::TextureManager::setAsyncSvgRasterizationEnabled(false);
+        REQUIRE(!tgui::TextureManager::isAsyncSvgRasterizationEnabled());
+
+        svgSprite.setSize({60, 40});
+        REQUIRE(rasterizedSizes.size() == 3);
+        REQUIRE(tgui::TextureManager::processPendingUploads() == 0);
+
+        tgui::TextureManager::setSvgRasterizationCallback(nullptr);
+        tgui::TextureManager::clearSvgCache();
+    }
+
     SECTION("getTexture has a version to change the texture and a const version")
     {
         sprite.getTexture().setSmooth(false);
@@ -134,5 +134,36 @@ TEST_CASE("[Text]")
             text3.setFont("resources/DejaVuSans.ttf");
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
+
+        SECTION("Measurement matches the glyphs of the font")
+        {
+            const sf::String str = L"AVA Wo\tT\u00EB\u0416\u0416 To\nAV";
+            std::shared_ptr<sf::Font> font = text.getFont();
+            for (const bool bold : {false, true})
+            {
+                float expectedWidth = 0;
+                std::uint32_t prevChar = 0;
+                for (std::size_t i = 0; str[i] != '\n'; ++i)
+                {
+                    const std::uint32_t curChar = (str[i] == '\t') ? U' ' : str[i];
+                    const float advance = font->getGlyph(curChar, 20, bold).advance * ((str[i] == '\t') ? 4.f : 1.f);
+                    expectedWidth = expectedWidth + advance + font->getKerning(prevChar, str[i], 20);
+                    prevChar = str[i];
+                }
+
+                // Measure twice, the second time the values come from the cache
+                const tgui::TextStyle style = bold ? sf::Text::Bold : sf::Text::Regular;
+                REQUIRE(tgui::Text::getLineWidth(str, font, 20, style) == expectedWidth);
+                REQUIRE(tgui::Text::getLineWidth(str, font, 20, style) == expectedWidth);
+            }
+
+            // Fonts that are destroyed and loaded again are still measured correctly
+            const float width = tgui::Text::getLineWidth("ABC", font, 30);
+            text.setFont(nullptr);
+            font = nullptr;
+            tgui::Font otherFont{"resources/DejaVuSans.ttf"};
+            REQUIRE(tgui::Text::getLineWidth("ABC", otherFont, 30) == width);
+            REQUIRE(tgui::Text::getLineWidth("ABC", otherFont, 15) < width);
+        }
     }
 }
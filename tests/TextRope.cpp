@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextRope.hpp>
+
+TEST_CASE("[TextRope]")
+{
+    SECTION("Construction")
+    {
+        tgui::priv::TextRope rope;
+        REQUIRE(rope.isEmpty());
+        REQUIRE(rope.getSize() == 0);
+        REQUIRE(rope.toString() == "");
+
+        tgui::priv::TextRope rope2{"Hello world"};
+        REQUIRE(!rope2.isEmpty());
+        REQUIRE(rope2.getSize() == 11);
+        REQUIRE(rope2.toString() == "Hello world");
+        REQUIRE(rope2[0] == 'H');
+        REQUIRE(rope2[10] == 'd');
+    }
+
+    SECTION("Insert and erase")
+    {
+        tgui::priv::TextRope rope{"Hello world"};
+        rope.insert(5, ",");
+        rope.insert(0, ">");
+        rope.insert(rope.getSize(), "!");
+        REQUIRE(rope.toString() == ">Hello, world!");
+
+        rope.erase(0, 1);
+        rope.erase(5, 2);
+        REQUIRE(rope.toString() == "Helloworld!");
+
+        rope.erase(5);
+        REQUIRE(rope.toString() == "Hello");
+
+        rope.erase(2, 100);
+        REQUIRE(rope.toString() == "He");
+
+        rope.clear();
+        REQUIRE(rope.isEmpty());
+    }
+
+    SECTION("Large text")
+    {
+        // The text is large enough to be split over many chunks
+        sf::String string;
+        for (unsigned int i = 0; i < 5000; ++i)
+            string += std::to_string(i % 10) + "\n";
+
+        tgui::priv::TextRope rope{string};
+        REQUIRE(rope.getSize() == string.getSize());
+
+        for (std::size_t i = 0; i < 200; ++i)
+        {
+            const std::size_t position = (i * 7919) % string.getSize();
+            rope.insert(position, "abc");
+            string.insert(position, "abc");
+
+            rope.erase(position / 2, 2);
+            string.erase(position / 2, 2);
+        }
+
+        REQUIRE(rope.toString() == string);
+        REQUIRE(rope.substring(1234, 567) == string.substring(1234, 567));
+        REQUIRE(rope.substring(9000) == string.substring(9000));
+        REQUIRE(rope[4321] == string[4321]);
+    }
+
+    SECTION("Find")
+    {
+        tgui::priv::TextRope rope{"line 1\nline 2\nline 3"};
+        REQUIRE(rope.find('\n') == 6);
+        REQUIRE(rope.find('\n', 7) == 13);
+        REQUIRE(rope.find('\n', 14) == sf::String::InvalidPos);
+        REQUIRE(rope.findLast('\n', rope.getSize()) == 13);
+        REQUIRE(rope.findLast('\n', 13) == 6);
+        REQUIRE(rope.findLast('\n', 6) == sf::String::InvalidPos);
+    }
+
+    SECTION("Copy")
+    {
+        tgui::priv::TextRope rope{"original"};
+        tgui::priv::TextRope copy{rope};
+        copy.insert(0, "not ");
+        REQUIRE(rope.toString() == "original");
+        REQUIRE(copy.toString() == "not original");
+
+        rope = copy;
+        copy.clear();
+        REQUIRE(rope.toString() == "not original");
+    }
+}
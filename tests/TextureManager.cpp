@@ -30,26 +30,188 @@
 
 TEST_CASE("[TextureManager]")
 {
-    std::streambuf *oldbuf = sf::err().rdbuf(0);
-    tgui::Texture texture;
-    REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png") == nullptr);
-    sf::err().rdbuf(oldbuf);
-
-    tgui::Texture texture1;
-    tgui::Texture texture2;
-    std::shared_ptr<tgui::TextureData> textureData1 = tgui::TextureManager::getTexture(texture1, "resources/image.png");
-    std::shared_ptr<tgui::TextureData> textureData2 = tgui::TextureManager::getTexture(texture2, "resources/image.png");
-    REQUIRE(textureData1 != nullptr);
-    REQUIRE(textureData2 != nullptr);
-    REQUIRE(textureData1 == textureData2);
-
-    REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(nullptr), tgui::Exception);
-    REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
-    REQUIRE_NOTHROW(tgui::TextureManager::copyTexture(textureData1));
-
-    REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
-    REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+    SECTION("Reference counting")
+    {
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        tgui::Texture texture;
+        REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png") == nullptr);
+        sf::err().rdbuf(oldbuf);
+
+        tgui::Texture texture1;
+        tgui::Texture texture2;
+        std::shared_ptr<tgui::TextureData> textureData1 = tgui::TextureManager::getTexture(texture1, "resources/image.png");
+        std::shared_ptr<tgui::TextureData> textureData2 = tgui::TextureManager::getTexture(texture2, "resources/image.png");
+        REQUIRE(textureData1 != nullptr);
+        REQUIRE(textureData2 != nullptr);
+        REQUIRE(textureData1 == textureData2);
+
+        REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(nullptr), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::TextureManager::copyTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
+        REQUIRE_NOTHROW(tgui::TextureManager::copyTexture(textureData1));
+        REQUIRE(textureData1->users == 3);
+
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(std::make_shared<tgui::TextureData>()), tgui::Exception);
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
+        REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+    }
+
+    SECTION("Many parts of the same image")
+    {
+        std::vector<tgui::Texture> textures;
+        for (int i = 0; i < 100; ++i)
+            textures.emplace_back("resources/image.png", sf::IntRect{i % 10, i / 10, 20, 20});
+
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(textures[i].getData()->users == 1);
+            REQUIRE(textures[i].getData()->rect == sf::IntRect(i % 10, i / 10, 20, 20));
+        }
+
+        const std::vector<tgui::Texture> copies = textures;
+        REQUIRE(copies[42].getData() == textures[42].getData());
+        REQUIRE(textures[42].getData()->users == 2);
+
+        tgui::Texture texture{"resources/image.png", {2, 4, 20, 20}};
+        REQUIRE(texture.getData() == textures[42].getData());
+        REQUIRE(texture.getData()->users == 3);
+    }
+
+    SECTION("Preloading textures")
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> progress;
+        tgui::TextureManager::preloadTexturesAsync({"resources/image.png", "resources/SFML.svg", "resources/NonExistent.png"},
+            [&](std::size_t loadedCount, std::size_t totalCount){ progress.emplace_back(loadedCount, totalCount); });
+
+        // Nothing is finished until the textures are created on this thread
+        REQUIRE(progress.empty());
+
+        std::streambuf *oldbuf = sf::err().rdbuf(0);
+        REQUIRE(tgui::TextureManager::processPendingUploads(true) == 3);
+        sf::err().rdbuf(oldbuf);
+
+        REQUIRE(progress == std::vector<std::pair<std::size_t, std::size_t>>{{1, 3}, {2, 3}, {3, 3}});
+
+        // Only the svg texture was created in advance, other images are uploaded when they are used
+        tgui::Texture texture{"resources/image.png"};
+        tgui::Texture svgTexture{"resources/SFML.svg"};
+        REQUIRE(texture.getData()->users == 1);
+        REQUIRE(svgTexture.getData()->users == 2);
+
+        // Parts of a preloaded image don't have to be decoded again
+        bool imageLoaderCalled = false;
+        const auto oldImageLoader = tgui::Texture::getImageLoader();
+        tgui::Texture::setImageLoader([&](const sf::String& filename){ imageLoaderCalled = true; return oldImageLoader(filename); });
+        tgui::Texture partTexture{"resources/image.png", {10, 10, 20, 30}};
+        tgui::Texture::setImageLoader(oldImageLoader);
+        REQUIRE(!imageLoaderCalled);
+        REQUIRE(partTexture.getImageSize() == sf::Vector2f(20, 30));
+
+        tgui::TextureManager::releasePreloadedTextures();
+        REQUIRE(texture.getData()->users == 1);
+        REQUIRE(svgTexture.getData()->users == 1);
+    }
+
+    SECTION("Keeping images in memory")
+    {
+        REQUIRE(tgui::TextureManager::getKeepImagesAfterUpload());
+        const std::size_t oldMemoryUsage = tgui::TextureManager::getImageMemoryUsage();
+        {
+            tgui::Texture texture{"resources/Texture1.png", {0, 0, 40, 40}};
+            REQUIRE(texture.getData()->image != nullptr);
+            REQUIRE(tgui::TextureManager::getImageMemoryUsage() == oldMemoryUsage + 50 * 50 * 4);
+        }
+
+        tgui::TextureManager::setKeepImagesAfterUpload(false);
+        REQUIRE(!tgui::TextureManager::getKeepImagesAfterUpload());
+        {
+            // Only the transparency of the pixels in the part rect is stored
+            tgui::Texture texture{"resources/Texture1.png", {0, 0, 40, 40}};
+            REQUIRE(texture.getData()->image == nullptr);
+            REQUIRE(texture.getData()->alphaMask.size() == 40 * 40);
+            REQUIRE(tgui::TextureManager::getImageMemoryUsage() == oldMemoryUsage + 40 * 40 / 8);
+        }
+
+        tgui::TextureManager::setKeepImagesAfterUpload(true);
+        REQUIRE(tgui::TextureManager::getImageMemoryUsage() == oldMemoryUsage);
+    }
+
+    SECTION("Texture atlas")
+    {
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+        REQUIRE(tgui::TextureManager::getAtlasPageSize() == 2048);
+        tgui::TextureManager::setAtlasPageSize(128);
+        REQUIRE(tgui::TextureManager::getAtlasPageSize() == 128);
+
+        {
+            // Three images of 50x50 (plus padding) fit next to each other on the first row
+            tgui::Texture texture1{"resources/Texture1.png"};
+            tgui::Texture texture2{"resources/Texture2.png"};
+            tgui::Texture texture3{"resources/image.png", {10, 10, 20, 30}};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            REQUIRE(texture1.getData()->atlasTexture == texture2.getData()->atlasTexture);
+            REQUIRE(texture1.getData()->atlasRect == sf::IntRect(0, 0, 50, 50));
+            REQUIRE(texture2.getData()->atlasRect == sf::IntRect(51, 0, 50, 50));
+            REQUIRE(texture3.getData()->atlasRect == sf::IntRect(102, 0, 20, 30));
+            REQUIRE(texture3.getImageSize() == sf::Vector2f(20, 30));
+
+            // The next image doesn't fit on the first row, but it does fit below the smaller image
+            tgui::Texture texture4{"resources/Texture3.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            REQUIRE(texture4.getData()->atlasRect == sf::IntRect(0, 51, 50, 50));
+
+            // Another page is created when there is no more space
+            tgui::Texture texture5{"resources/Texture4.png"};
+            tgui::Texture texture6{"resources/Texture5.png"};
+            tgui::Texture texture7{"resources/Texture6.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 2);
+            REQUIRE(texture7.getData()->atlasTexture != texture1.getData()->atlasTexture);
+
+            // Smoothing can't be changed for a single image in a page
+            REQUIRE(!texture1.isSmooth());
+            texture1.setSmooth(true);
+            REQUIRE(texture1.isSmooth());
+            REQUIRE(texture1.getData()->atlasTexture == nullptr);
+            REQUIRE(texture1.getImageSize() == sf::Vector2f(50, 50));
+
+            // Without the pixels in memory, only the part of the page containing the image is copied
+            tgui::TextureManager::setKeepImagesAfterUpload(false);
+            tgui::Texture texture8{"resources/image.png", {0, 0, 40, 30}};
+            tgui::TextureManager::setKeepImagesAfterUpload(true);
+            REQUIRE(texture8.getData()->atlasTexture != nullptr);
+            texture8.setSmooth(true);
+            REQUIRE(texture8.getData()->atlasTexture == nullptr);
+            REQUIRE(texture8.getData()->texture.getSize() == sf::Vector2u(40, 30));
+            REQUIRE(texture8.isSmooth());
+        }
+
+        // Pages are destroyed when none of their images are still used
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        {
+            // Space of removed images is reused by repacking the page when a new image doesn't fit anywhere
+            tgui::Texture texture4;
+            {
+                tgui::Texture texture1{"resources/Texture1.png"};
+                tgui::Texture texture2{"resources/Texture2.png"};
+                tgui::Texture texture3{"resources/Texture3.png"};
+                texture4 = tgui::Texture{"resources/Texture4.png"};
+                REQUIRE(texture4.getData()->atlasRect == sf::IntRect(51, 51, 50, 50));
+            }
+
+            tgui::Texture texture5{"resources/Texture5.png"};
+            REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+            REQUIRE(texture5.getData()->atlasTexture == texture4.getData()->atlasTexture);
+            REQUIRE(texture4.getData()->atlasRect == sf::IntRect(0, 0, 50, 50));
+            REQUIRE(texture5.getData()->atlasRect == sf::IntRect(51, 0, 50, 50));
+        }
+
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+        tgui::TextureManager::setAtlasPageSize(2048);
+        tgui::TextureManager::setAtlasEnabled(false);
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+    }
 }
@@ -133,6 +133,21 @@ TEST_CASE("[ChatBox]")
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
         }
+
+        SECTION("Many lines")
+        {
+            chatBox->setLineLimit(100);
+            for (unsigned int i = 0; i < 1000; ++i)
+                chatBox->addLine("Line " + tgui::to_string(i));
+
+            REQUIRE(chatBox->getLineAmount() == 100);
+            REQUIRE(chatBox->getLine(0) == "Line 900");
+            REQUIRE(chatBox->getLine(99) == "Line 999");
+
+            chatBox->setLineLimit(10);
+            REQUIRE(chatBox->getLineAmount() == 10);
+            REQUIRE(chatBox->getLine(0) == "Line 990");
+        }
     }
 
     SECTION("Text size")
@@ -113,6 +113,20 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItemById("3") == "");
     }
 
+    SECTION("Adding multiple items")
+    {
+        listBox->addItem("Item 1", "1");
+        REQUIRE(listBox->addItems({"Item 2", "Item 3"}, {"2", "3"}));
+        REQUIRE(listBox->addItems({"Item 4"}));
+        REQUIRE(listBox->getItems() == std::vector<sf::String>{"Item 1", "Item 2", "Item 3", "Item 4"});
+        REQUIRE(listBox->getItemIds() == std::vector<sf::String>{"1", "2", "3", ""});
+
+        listBox->setMaximumItems(5);
+        REQUIRE(!listBox->addItems({"Item 5", "Item 6"}));
+        REQUIRE(listBox->getItemCount() == 5);
+        REQUIRE(listBox->getItemByIndex(4) == "Item 5");
+    }
+
     SECTION("Removing items")
     {
         listBox->addItem("Item 1", "1");
@@ -247,6 +261,68 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Lookup index")
+    {
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+
+        REQUIRE(!listBox->isLookupIndexEnabled());
+        listBox->setLookupIndexEnabled(true);
+        REQUIRE(listBox->isLookupIndexEnabled());
+
+        listBox->addItem("Item 3", "3");
+        listBox->addItems({"Item 2", "Item 4"}, {"4", "2"});
+        REQUIRE(listBox->contains("Item 3"));
+        REQUIRE(listBox->containsId("4"));
+        REQUIRE(!listBox->contains("Item 5"));
+        REQUIRE(listBox->getItemById("3") == "Item 3");
+
+        // The first item with the name or id is used when they aren't unique
+        REQUIRE(listBox->setSelectedItem("Item 2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        REQUIRE(listBox->setSelectedItemById("2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        // Indices of the items after a removed item are updated
+        REQUIRE(listBox->removeItemById("1"));
+        REQUIRE(listBox->getItemById("2") == "Item 2");
+        REQUIRE(listBox->setSelectedItemById("4"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+        REQUIRE(listBox->removeItem("Item 2"));
+        REQUIRE(listBox->getItemById("2") == "Item 4");
+        REQUIRE(listBox->setSelectedItem("Item 2"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->changeItemById("3", "Item 5"));
+        REQUIRE(!listBox->contains("Item 3"));
+        REQUIRE(listBox->setSelectedItem("Item 5"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        listBox->setMaximumItems(1);
+        REQUIRE(!listBox->containsId("4"));
+        REQUIRE(listBox->containsId("3"));
+
+        listBox->removeAllItems();
+        REQUIRE(!listBox->contains("Item 5"));
+
+        // Duplicate names keep the correct indices when items in front of them are removed
+        for (unsigned int i = 0; i < 100; ++i)
+            listBox->addItem("Item " + std::to_string(i % 3), std::to_string(i));
+        for (unsigned int i = 0; i < 90; ++i)
+            REQUIRE(listBox->removeItemByIndex(i % 2));
+        REQUIRE(listBox->setSelectedItem("Item 0"));
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+        REQUIRE(listBox->setSelectedItemById("89"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+        REQUIRE(listBox->setSelectedItemById("99"));
+        REQUIRE(listBox->getSelectedItemIndex() == 9);
+        listBox->removeAllItems();
+
+        listBox->setLookupIndexEnabled(false);
+        listBox->addItem("Item 1", "1");
+        REQUIRE(listBox->containsId("1"));
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -215,6 +215,151 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndex() == -1);
     }
 
+    SECTION("Virtual items")
+    {
+        listView->addItem("Normal item");
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+
+        REQUIRE(!listView->isVirtual());
+        listView->setVirtualItems(1000000, [](std::size_t index, std::size_t column){
+            return tgui::to_string(index) + "," + tgui::to_string(column);
+        });
+        REQUIRE(listView->isVirtual());
+
+        REQUIRE(listView->getItemCount() == 1000000);
+        REQUIRE(listView->getItem(0) == "0,0");
+        REQUIRE(listView->getItem(999999) == "999999,0");
+        REQUIRE(listView->getItem(1000000) == "");
+        REQUIRE(listView->getItemRow(123456) == std::vector<sf::String>{"123456,0", "123456,1"});
+
+        listView->setSelectedItem(500000);
+        REQUIRE(listView->getSelectedItemIndex() == 500000);
+
+        // Items can't be changed directly in virtual mode
+        REQUIRE(!listView->removeItem(0));
+        REQUIRE(!listView->changeItem(0, {"Changed"}));
+        REQUIRE(listView->getItemCount() == 1000000);
+
+        listView->setVirtualItemCount(3);
+        REQUIRE(listView->getItemCount() == 3);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"0,0", "0,1"}, {"1,0", "1,1"}, {"2,0", "2,1"}});
+
+        listView->removeAllItems();
+        REQUIRE(!listView->isVirtual());
+        REQUIRE(listView->getItemCount() == 0);
+        listView->addItem("Normal item");
+        REQUIRE(listView->getItemCount() == 1);
+    }
+
+    SECTION("Sorting and filtering")
+    {
+        listView->addItem({"b", "10"});
+        listView->addItem({"c", "9"});
+        listView->addItem({"a", "10"});
+        listView->addItem({"b", "-2.5"});
+
+        auto getDisplayedItems = [listView]{
+            std::vector<int> indices;
+            for (std::size_t row = 0; row < listView->getDisplayedItemCount(); ++row)
+                indices.push_back(listView->getDisplayedItemIndex(row));
+            return indices;
+        };
+
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 1, 2, 3});
+        REQUIRE(listView->getDisplayedItemIndex(4) == -1);
+
+        // Sorting is stable and doesn't change the indices of the items
+        listView->sortItems(0);
+        REQUIRE(listView->getSortColumn() == 0);
+        REQUIRE(listView->isSortedAscending());
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 0, 3, 1});
+        REQUIRE(listView->getItem(0) == "b");
+
+        listView->sortItems(0, tgui::ListView::SortMode::Lexicographic, false);
+        REQUIRE(!listView->isSortedAscending());
+        REQUIRE(getDisplayedItems() == std::vector<int>{1, 0, 3, 2});
+
+        listView->sortItems(1);
+        REQUIRE(getDisplayedItems() == std::vector<int>{3, 0, 2, 1});
+
+        listView->sortItems(1, tgui::ListView::SortMode::Numeric);
+        REQUIRE(getDisplayedItems() == std::vector<int>{3, 1, 0, 2});
+
+        listView->sortItems(1, [](const sf::String& left, const sf::String& right){ return left.getSize() > right.getSize(); });
+        REQUIRE(getDisplayedItems() == std::vector<int>{3, 0, 2, 1});
+
+        // New and changed items are placed at the correct position
+        listView->sortItems(0);
+        REQUIRE(listView->addItem({"b", "0"}) == 4);
+        REQUIRE(listView->addItem("0") == 5);
+        REQUIRE(getDisplayedItems() == std::vector<int>{5, 2, 0, 3, 4, 1});
+        listView->changeItem(1, {"a"});
+        listView->changeSubItem(5, 0, "z");
+        REQUIRE(getDisplayedItems() == std::vector<int>{1, 2, 0, 3, 4, 5});
+        listView->removeItem(0);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 1, 2, 3, 4});
+
+        // Filtering only shows the items for which the filter returns true
+        listView->setSelectedItem(0);
+        tgui::ListView* listViewPtr = listView.get();
+        listView->setItemFilter([listViewPtr](std::size_t index){ return listViewPtr->getItem(index) == "b"; });
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 3});
+        REQUIRE(listView->getDisplayedItemCount() == 2);
+        REQUIRE(listView->getItemCount() == 5);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+
+        listView->setSelectedItem(0);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        listView->setSelectedItem(3);
+        REQUIRE(listView->getSelectedItemIndex() == 3);
+
+        listView->addItem("b");
+        listView->addItem("c");
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 3, 5});
+
+        listView->removeSorting();
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(getDisplayedItems() == std::vector<int>{2, 3, 5});
+
+        listView->setItemFilter(nullptr);
+        REQUIRE(getDisplayedItems() == std::vector<int>{0, 1, 2, 3, 4, 5, 6});
+        REQUIRE(listView->getSelectedItemIndex() == 3);
+    }
+
+    SECTION("Sorting large lists")
+    {
+        // The list is large enough to be sorted in several parts that are merged afterwards
+        const std::size_t itemCount = 40000;
+        for (std::size_t i = 0; i < itemCount; ++i)
+            listView->addItem({tgui::to_string(i % 7), tgui::to_string(i % 13)});
+
+        auto isSortedStable = [listView](std::size_t column, bool ascending){
+            for (std::size_t row = 1; row < listView->getDisplayedItemCount(); ++row)
+            {
+                const int previous = listView->getDisplayedItemIndex(row - 1);
+                const int current = listView->getDisplayedItemIndex(row);
+                const int previousKey = std::stoi(listView->getItemRow(previous)[column].toAnsiString());
+                const int currentKey = std::stoi(listView->getItemRow(current)[column].toAnsiString());
+                if ((ascending ? (currentKey < previousKey) : (currentKey > previousKey)) || ((currentKey == previousKey) && (current < previous)))
+                    return false;
+            }
+            return true;
+        };
+
+        listView->sortItems(0);
+        REQUIRE(listView->getDisplayedItemCount() == itemCount);
+        REQUIRE(isSortedStable(0, true));
+
+        listView->sortItems(1, tgui::ListView::SortMode::Numeric);
+        REQUIRE(isSortedStable(1, true));
+
+        listView->sortItems(1, tgui::ListView::SortMode::Numeric, false);
+        REQUIRE(isSortedStable(1, false));
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -475,9 +620,20 @@ TEST_CASE("[ListView]")
             listView->addColumn("Col 1", 50);
             listView->addColumn("Col 2", 50);
 
+            int lastColumn = -1;
+            unsigned int headerClickedCount = 0;
+            listView->connect("HeaderClicked", [&](int column){ lastColumn = column; ++headerClickedCount; });
+
             mousePressed({40, 35});
             mouseReleased({40, 35});
             REQUIRE(listView->getSelectedItemIndex() == -1);
+            REQUIRE(headerClickedCount == 1);
+            REQUIRE(lastColumn == 0);
+
+            mousePressed({80, 35});
+            mouseReleased({80, 35});
+            REQUIRE(headerClickedCount == 2);
+            REQUIRE(lastColumn == 1);
 
             listView->setHeaderVisible(false);
             mousePressed({40, 35});
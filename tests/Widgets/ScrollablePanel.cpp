@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/ScrollablePanel.hpp>
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
 
 TEST_CASE("[ScrollablePanel]")
@@ -283,6 +284,90 @@ TEST_CASE("[ScrollablePanel]")
         }
     }
 
+    SECTION("Culling")
+    {
+        sf::RenderTexture target;
+        target.create(200, 150);
+        tgui::Gui gui{target};
+        gui.add(panel);
+
+        panel->setSize({180, 140});
+        panel->setPosition({10, 5});
+
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            auto child = tgui::Panel::create({100, 20});
+            child->setPosition({0, i * 25.f});
+            child->getRenderer()->setBackgroundColor(sf::Color::Green);
+            panel->add(child);
+        }
+
+        // Only the few children that fit inside the panel are drawn
+        gui.draw();
+        REQUIRE(gui.getDrawCallCount() < 50);
+
+        SECTION("Updating offscreen widgets")
+        {
+            auto visibleChild = panel->getWidgets()[1];
+            auto offscreenChild = panel->getWidgets()[900];
+            auto offscreenChildNotUpdated = panel->getWidgets()[901];
+            offscreenChildNotUpdated->setUpdatedWhileOffscreen(false);
+            REQUIRE(!offscreenChildNotUpdated->isUpdatedWhileOffscreen());
+            REQUIRE(visibleChild->isUpdatedWhileOffscreen());
+
+            visibleChild->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(1000));
+            offscreenChild->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(1000));
+            offscreenChildNotUpdated->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(1000));
+
+            gui.draw();
+            const float opacityBeforeUpdate = offscreenChildNotUpdated->getInheritedOpacity();
+
+            gui.updateTime(sf::milliseconds(500));
+            REQUIRE(visibleChild->getInheritedOpacity() > 0.4f);
+            REQUIRE(offscreenChild->getInheritedOpacity() > 0.4f);
+            REQUIRE(offscreenChildNotUpdated->getInheritedOpacity() == opacityBeforeUpdate);
+
+            // The widget is updated again once it gets moved into view
+            offscreenChildNotUpdated->setPosition({0, 0});
+            gui.draw();
+            gui.updateTime(sf::milliseconds(100));
+            REQUIRE(offscreenChildNotUpdated->getInheritedOpacity() > opacityBeforeUpdate);
+        }
+
+        SECTION("Spatial index")
+        {
+            // The children that are drawn are found with the grid, but they are still drawn in the same order
+            const auto drawGui = [&](const std::string& filename){
+                target.clear();
+                gui.draw();
+                target.display();
+                target.getTexture().copyToImage().saveToFile(filename);
+            };
+
+            panel->getWidgets()[2]->setPosition({20, 15});
+            panel->getWidgets()[2]->cast<tgui::Panel>()->getRenderer()->setBackgroundColor(sf::Color::Blue);
+            drawGui("ScrollablePanel_CullingWithoutIndex.png");
+            const unsigned int drawCallsWithoutIndex = gui.getDrawCallCount();
+
+            panel->setSpatialIndexEnabled(true);
+            drawGui("ScrollablePanel_CullingWithIndex.png");
+            REQUIRE(gui.getDrawCallCount() == drawCallsWithoutIndex);
+            compareImageFiles("ScrollablePanel_CullingWithIndex.png", "ScrollablePanel_CullingWithoutIndex.png");
+
+            auto offscreenChildNotUpdated = panel->getWidgets()[901];
+            offscreenChildNotUpdated->setUpdatedWhileOffscreen(false);
+            offscreenChildNotUpdated->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(1000));
+            const float opacityBeforeUpdate = offscreenChildNotUpdated->getInheritedOpacity();
+            gui.updateTime(sf::milliseconds(500));
+            REQUIRE(offscreenChildNotUpdated->getInheritedOpacity() == opacityBeforeUpdate);
+
+            offscreenChildNotUpdated->setPosition({0, 0});
+            gui.draw();
+            gui.updateTime(sf::milliseconds(100));
+            REQUIRE(offscreenChildNotUpdated->getInheritedOpacity() > opacityBeforeUpdate);
+        }
+    }
+
     SECTION("Draw")
     {
         TEST_DRAW_INIT(200, 150, panel)
@@ -211,6 +211,46 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->getLinesCount() == 4);
     }
 
+    SECTION("Editing only rearranges the changed lines")
+    {
+        textBox->setSize(165, 100);
+        textBox->setTextSize(24);
+
+        // The result of an edit has to be the same as when the whole text would be set at once
+        tgui::TextBox::Ptr textBoxWithSameText = tgui::TextBox::copy(textBox);
+        auto requireSameLines = [&]{
+            textBoxWithSameText->setText(textBox->getText());
+            REQUIRE(textBox->getLinesCount() == textBoxWithSameText->getLinesCount());
+        };
+
+        textBox->setText("ABCDEFGHIJKLMNOPQRSTUVWXYZ\n\nABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        const std::size_t linesCount = textBox->getLinesCount();
+
+        textBox->setCaretPosition(5);
+        textBox->textEntered('\n');
+        REQUIRE(textBox->getText() == "ABCDE\nFGHIJKLMNOPQRSTUVWXYZ\n\nABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        REQUIRE(textBox->getCaretPosition() == 6);
+        requireSameLines();
+
+        textBox->setSelectedText(3, 29);
+        textBox->textEntered('-');
+        REQUIRE(textBox->getText() == "ABC-ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        REQUIRE(textBox->getSelectionStart() == 4);
+        REQUIRE(textBox->getSelectionEnd() == 4);
+        requireSameLines();
+
+        textBox->addText("\n\nABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        REQUIRE(textBox->getCaretPosition() == 58);
+        requireSameLines();
+
+        textBox->setSelectedText(8, 3);
+        textBox->textEntered('D');
+        REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZ\n\nABCDEFGHIJKLMNOPQRSTUVWXYZ");
+        REQUIRE(textBox->getCaretPosition() == 4);
+        REQUIRE(textBox->getLinesCount() == linesCount);
+        requireSameLines();
+    }
+
     SECTION("Events / Signals")
     {
         textBox->setSize(165, 100);
@@ -214,6 +214,85 @@ TEST_CASE("[TreeView]")
         REQUIRE(treeView->getSelectedItem().empty());
     }
 
+    SECTION("Changing items around the selected item")
+    {
+        treeView->addItem({"Smilies", "Neither"});
+        treeView->addItem({"Vehicles", "Parts", "Wheel"});
+        treeView->addItem({"Vehicles", "Whole", "Car"});
+
+        REQUIRE(treeView->selectItem({"Vehicles", "Parts", "Wheel"}));
+
+        // Items that are added, removed, expanded or collapsed above the selected item don't change the selection
+        treeView->addItem({"Smilies", "Happy"});
+        treeView->collapse({"Smilies"});
+        treeView->removeItem({"Vehicles", "Whole", "Car"});
+        treeView->addItem({"Animals", "Cat"});
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"Vehicles", "Parts", "Wheel"});
+
+        treeView->expand({"Smilies"});
+        treeView->collapse({"Vehicles", "Parts"});
+        REQUIRE(treeView->getSelectedItem().empty());
+
+        REQUIRE(treeView->selectItem({"Smilies", "Happy"}));
+        auto treeViewCopy = tgui::TreeView::copy(treeView);
+        REQUIRE(treeViewCopy->getSelectedItem() == std::vector<sf::String>{"Smilies", "Happy"});
+    }
+
+    SECTION("Items with the same text")
+    {
+        treeView->addItem({"Same"});
+        treeView->addItem({"Same"});
+        treeView->addItem({"Same", "First"});
+        REQUIRE(treeView->getNodes().size() == 2);
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(treeView->getNodes()[1].nodes.empty());
+
+        // Once the first item is removed, the hierarchy refers to the second one
+        REQUIRE(treeView->removeItem({"Same", "First"}));
+        REQUIRE(treeView->getNodes().size() == 1);
+        treeView->addItem({"Same", "Second"});
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 1);
+        REQUIRE(treeView->getNodes()[0].nodes[0].text == "Second");
+    }
+
+    SECTION("Lazy items")
+    {
+        unsigned int populateCount = 0;
+        tgui::TreeView* treeViewPtr = treeView.get();
+        treeView->connect("Populate", [&](std::vector<sf::String> hierarchy){
+            ++populateCount;
+            hierarchy.push_back("Child 1");
+            treeViewPtr->addItem(hierarchy);
+            hierarchy.back() = "Child 2";
+            treeViewPtr->addItem(hierarchy);
+        });
+
+        REQUIRE(treeView->addLazyItem({"Folder"}));
+        REQUIRE(treeView->addLazyItem({"Parent", "Lazy"}));
+        REQUIRE(!treeView->addLazyItem({"Unexisting", "Lazy"}, false));
+        REQUIRE(!treeView->getNodes()[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes.empty());
+
+        treeView->expandAll();
+        REQUIRE(populateCount == 0);
+
+        treeView->expand({"Folder"});
+        REQUIRE(populateCount == 1);
+        REQUIRE(treeView->getNodes()[0].expanded);
+        REQUIRE(treeView->getNodes()[0].nodes.size() == 2);
+        REQUIRE(treeView->getNodes()[0].nodes[1].text == "Child 2");
+
+        // Children are only requested the first time
+        treeView->collapse({"Folder"});
+        treeView->expand({"Folder"});
+        REQUIRE(populateCount == 1);
+
+        // Selecting an item expands its parents, which populates them
+        REQUIRE(treeView->selectItem({"Parent", "Lazy", "Child 1"}));
+        REQUIRE(populateCount == 2);
+        REQUIRE(treeView->getSelectedItem() == std::vector<sf::String>{"Parent", "Lazy", "Child 1"});
+    }
+
     SECTION("ItemHeight")
     {
         treeView->setItemHeight(30);
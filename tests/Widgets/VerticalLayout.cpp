@@ -140,6 +140,45 @@ TEST_CASE("[VerticalLayout]")
         REQUIRE(layout->get(0) == nullptr);
     }
 
+    SECTION("Spatial index")
+    {
+        // Let the buttons overlap, so that the order of the widgets matters
+        layout->getRenderer()->setSpaceBetweenWidgets(-20);
+        layout->setSpatialIndexEnabled(true);
+
+        auto button1 = tgui::Button::create();
+        auto button2 = tgui::Button::create();
+        auto button3 = tgui::Button::create();
+        layout->add(button1);
+        layout->add(button2);
+        layout->insert(0, button3);
+        REQUIRE(layout->get(0) == button3);
+        REQUIRE(layout->get(1) == button1);
+
+        tgui::Widget* pressedWidget = nullptr;
+        for (auto& button : {button1, button2, button3})
+        {
+            tgui::Widget* widget = button.get();
+            button->onMousePress.connect([&pressedWidget,widget]{ pressedWidget = widget; });
+        }
+
+        const auto click = [&](tgui::Vector2f pos){
+            pressedWidget = nullptr;
+            layout->leftMousePressed(layout->getPosition() + pos);
+            layout->leftMouseReleased(layout->getPosition() + pos);
+            layout->leftMouseButtonNoLongerDown();
+            return pressedWidget;
+        };
+
+        // The inserted button lies behind the button that comes after it
+        const tgui::Vector2f overlapPos{10, button1->getPosition().y + 10};
+        REQUIRE(button3->getPosition().y + button3->getSize().y > overlapPos.y);
+        REQUIRE(click(overlapPos) == button1.get());
+
+        layout->setSpatialIndexEnabled(false);
+        REQUIRE(click(overlapPos) == button1.get());
+    }
+
     SECTION("Saving and loading from file")
     {
         layout->add(tgui::Button::create("Hello"));
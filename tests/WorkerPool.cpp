@@ -0,0 +1,72 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/WorkerPool.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <atomic>
+
+TEST_CASE("[WorkerPool]")
+{
+    SECTION("Thread count")
+    {
+        tgui::priv::WorkerPool pool{3};
+        REQUIRE(pool.getThreadCount() == 3);
+
+        tgui::priv::WorkerPool defaultPool;
+        REQUIRE(defaultPool.getThreadCount() >= 1);
+    }
+
+    SECTION("Executing jobs")
+    {
+        tgui::priv::WorkerPool pool{4};
+
+        std::atomic<unsigned int> counter{0};
+        for (unsigned int i = 0; i < 100; ++i)
+            pool.post([&]{ ++counter; });
+
+        pool.waitUntilIdle();
+        REQUIRE(counter == 100);
+
+        // The pool can still be used after waiting
+        pool.post([&]{ ++counter; });
+        pool.waitUntilIdle();
+        REQUIRE(counter == 101);
+    }
+
+    SECTION("Results on the gui thread")
+    {
+        tgui::CommandQueue queue;
+        tgui::priv::WorkerPool pool{2};
+
+        std::vector<unsigned int> results;
+        for (unsigned int i = 0; i < 10; ++i)
+            pool.post([&queue,&results,i]{ queue.post([&results,i]{ results.push_back(i * i); }); });
+
+        pool.waitUntilIdle();
+        REQUIRE(queue.execute() == 10);
+        REQUIRE(results.size() == 10);
+    }
+}